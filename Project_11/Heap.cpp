@@ -47,9 +47,27 @@ template<typename DataType, typename KeyType, typename Comparator>
 Heap<DataType, KeyType, Comparator>::
     Heap(const Heap<DataType, KeyType, Comparator>& other)
 {
+    maxSize = size = 0;
+    dataItems = NULL;
     *this = other;
 }
 
+/** The move constructor
+* that takes over the memory of the other Heap.
+* @post The other Heap will be an empty Heap without any memory.
+* @param other is the Heap whose data items are taken over.
+*/
+template<typename DataType, typename KeyType, typename Comparator>
+Heap<DataType, KeyType, Comparator>::
+    Heap(Heap<DataType, KeyType, Comparator>&& other)
+{
+    maxSize = other.maxSize;
+    size = other.size;
+    dataItems = other.dataItems;
+    other.maxSize = other.size = 0;
+    other.dataItems = NULL;
+}
+
 /** The overloaded assignment operator
 * that sets this Heap to be equivalent to the other Heap object parameter.
 * @pre other is a valid Heap.
@@ -67,16 +85,44 @@ Heap<DataType, KeyType, Comparator>& Heap<DataType, KeyType, Comparator>::
     //Check for empty
     if(isEmpty() == false)
         clear();
-    //Copy Heap properties
-    size = other.size;
-    maxSize = other.maxSize;
+    //Make room for the other Heap's data items
+    if(maxSize != other.maxSize)
+    {
+        delete[] dataItems;
+        maxSize = other.maxSize;
+        dataItems = new DataType[maxSize];
+    }
     //Deep copy
+    size = other.size;
     for(int i = 0; i < size; i++)
         dataItems[i] = other.dataItems[i];
 
     return *this;
 }
 
+/** The move assignment operator
+* that releases the memory of this Heap and takes over the memory of the other
+* Heap.
+* @post The other Heap will be an empty Heap without any memory.
+* @param other is the Heap whose data items are taken over.
+* @return The reference to this Heap.
+*/
+template<typename DataType, typename KeyType, typename Comparator>
+Heap<DataType, KeyType, Comparator>& Heap<DataType, KeyType, Comparator>::
+    operator=(Heap<DataType, KeyType, Comparator>&& other)
+{
+    if(this == &other)
+        return *this;
+
+    delete[] dataItems;
+    maxSize = other.maxSize;
+    size = other.size;
+    dataItems = other.dataItems;
+    other.maxSize = other.size = 0;
+    other.dataItems = NULL;
+    return *this;
+}
+
 /** The destructor
 * that deallocates the memory used to store this Heap.
 * @post This Heap will be an empty, deallocated, Heap.
@@ -85,7 +131,7 @@ template<typename DataType, typename KeyType, typename Comparator>
 Heap<DataType, KeyType, Comparator>::~Heap()
 {
     clear();
-    delete dataItems;
+    delete[] dataItems;
 }
 
 /** Inserts newDataItem
@@ -95,6 +141,7 @@ Heap<DataType, KeyType, Comparator>::~Heap()
 * @post newDataItem will be inserted into the Heap.
 * @param newDataItem is the data item to be inserted into this Heap.
 * @throw This Heap is full.
+* @see siftUp()
 */
 template<typename DataType, typename KeyType, typename Comparator>
 void Heap<DataType, KeyType, Comparator>::insert(const DataType& newDataItem)
@@ -103,24 +150,52 @@ void Heap<DataType, KeyType, Comparator>::insert(const DataType& newDataItem)
     //Insert if not full
     if(isFull() == false)
     {
-        int index = size;
-        Comparator compare;
         dataItems[size] = newDataItem;
-        //Compare the two data items
-        while(compare(dataItems[index].getPriority(), 
-            dataItems[(index - 1) / 2].getPriority()))
-        {
-            //Swap the two data items
-            DataType data = dataItems[index];
-            dataItems[index] = dataItems[(index - 1) / 2];
-            dataItems[(index - 1) / 2] = data;
-            index = (index - 1) / 2;
-        }
         size++;
+        siftUp(size - 1);
+    }
+    else
+        throw logic_error("Full List");
+}
+
+/** Moves newDataItem
+* into the heap the same way as insert(const DataType&) copies it.
+* @pre This Heap is not full.
+* @post newDataItem will be inserted into the Heap.
+* @param newDataItem is the data item to be moved into this Heap.
+* @throw This Heap is full.
+* @see siftUp()
+*/
+template<typename DataType, typename KeyType, typename Comparator>
+void Heap<DataType, KeyType, Comparator>::insert(DataType&& newDataItem)
+    throw (logic_error)
+{
+    //Insert if not full
+    if(isFull() == false)
+    {
+        dataItems[size] = std::move(newDataItem);
+        size++;
+        siftUp(size - 1);
     }
     else
         throw logic_error("Full List");
-}  
+}
+
+/** Constructs a data item from args
+* and moves it into the heap. The slots of a Heap are allocated up front, so
+* the new data item is moved into its slot rather than constructed there.
+* @pre This Heap is not full.
+* @post The new data item will be inserted into the Heap.
+* @param args are the constructor arguments for the new data item.
+* @throw This Heap is full.
+*/
+template<typename DataType, typename KeyType, typename Comparator>
+template<typename... Args>
+void Heap<DataType, KeyType, Comparator>::emplace(Args&&... args)
+    throw (logic_error)
+{
+    insert(DataType(std::forward<Args>(args)...));
+}
 
 /** Removes the highest priority data item
 * (the root) from this Heap and returns it. Replaces the root data item with the
@@ -130,6 +205,7 @@ void Heap<DataType, KeyType, Comparator>::insert(const DataType& newDataItem)
 * @post This Heap will no longer contain the highest priority data item.
 * @return The highest priority data item.
 * @throw This Heap is empty.
+* @see siftDown()
 */
 template<typename DataType, typename KeyType, typename Comparator>
 DataType Heap<DataType, KeyType, Comparator>::remove() throw (logic_error)
@@ -139,68 +215,61 @@ DataType Heap<DataType, KeyType, Comparator>::remove() throw (logic_error)
         throw logic_error("Empty List");
     }
 
-    size--;
     //Set the return data
-    DataType returnData = dataItems[0];
-    dataItems[0] = dataItems[size];
-
-    //Iterate through the Heap
-    int index = 0;
-    while(index < size)
+    DataType returnData = std::move(dataItems[0]);
+    size--;
+    if(size > 0)
     {
-        Comparator compare;
-        if((index * 2) + 2 <= size)
-        {
-            //No switch if same
-            if(compare(dataItems[index].getPriority(), 
-                dataItems[(index * 2) + 1].getPriority()) &&
-                compare(dataItems[index].getPriority(),
-                dataItems[(index * 2) + 2].getPriority()))
-            {
-                return returnData;
-            }
-            //Swap items if greater than
-            else if(compare(dataItems[(index * 2) + 2].getPriority(),
-                dataItems[(index * 2) + 1].getPriority()))
-            {
-                DataType temp = dataItems[index];
-                dataItems[index] = dataItems[(index * 2) + 2];
-                dataItems[(index * 2) + 2] = temp;
-                index = (index * 2) + 2;
-            }
-            //Swap items if less than
-            else
-            {
-                DataType temp = dataItems[index];
-                dataItems[index] = dataItems[index + 1];
-                dataItems[(index * 2) + 1] = temp;
-                index = (index * 2) + 1;
-            }
-        }
-        else if( (index * 2) + 1 <= size)
-        {
-            //Swap items if greater than
-            if(compare(dataItems[(index * 2) + 1].getPriority(),
-                dataItems[index].getPriority()))
-            {
-                DataType temp = dataItems[index];
-                dataItems[index] = dataItems[(index * 2) + 1];
-                dataItems[(index * 2) + 1] = temp;
-                index = (index * 2) + 1;
-            }
-            else
-            {
-                return returnData;
-            }
-        }
-        else
-        {
-            return returnData;
-        }
+        dataItems[0] = std::move(dataItems[size]);
+        siftDown(0);
     }
     return returnData;
 }
 
+/** Moves dataItems[index] upward
+* until its parent has a higher priority. Parents are shifted down into the
+* hole left behind instead of being swapped, so each step is a single move.
+* @param index is the position of the data item to move upward.
+*/
+template<typename DataType, typename KeyType, typename Comparator>
+void Heap<DataType, KeyType, Comparator>::siftUp(int index)
+{
+    DataType data = std::move(dataItems[index]);
+    while(index > 0 && comparator(data.getPriority(),
+        dataItems[(index - 1) / 2].getPriority()))
+    {
+        dataItems[index] = std::move(dataItems[(index - 1) / 2]);
+        index = (index - 1) / 2;
+    }
+    dataItems[index] = std::move(data);
+}
+
+/** Moves dataItems[index] downward
+* until neither child has a higher priority. The higher priority child is
+* shifted up into the hole left behind instead of being swapped.
+* @param index is the position of the data item to move downward.
+*/
+template<typename DataType, typename KeyType, typename Comparator>
+void Heap<DataType, KeyType, Comparator>::siftDown(int index)
+{
+    DataType data = std::move(dataItems[index]);
+    int child = (index * 2) + 1;
+    while(child < size)
+    {
+        //Pick the higher priority child
+        if(child + 1 < size && comparator(dataItems[child + 1].getPriority(),
+            dataItems[child].getPriority()))
+            child++;
+        //Stop once the data item outranks both children
+        if(!comparator(dataItems[child].getPriority(), data.getPriority()))
+            break;
+        dataItems[index] = std::move(dataItems[child]);
+        index = child;
+        child = (index * 2) + 1;
+    }
+    dataItems[index] = std::move(data);
+}
+
 /** Remove all data items
 * from this Heap.
 * @post This Heap will be an empty Heap.
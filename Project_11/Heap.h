@@ -11,6 +11,7 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 
 using namespace std;
 
@@ -30,7 +31,9 @@ class Heap
     // Constructor
     Heap ( int maxNumber = DEFAULT_MAX_HEAP_SIZE ); // Default constructor + basic constr
     Heap ( const Heap& other );		    // Copy constructor
+    Heap ( Heap&& other );		    // Move constructor
     Heap& operator= ( const Heap& other );  // Overloaded assignment operator
+    Heap& operator= ( Heap&& other );	    // Move assignment operator
 
     // Destructor
     ~Heap ();
@@ -38,6 +41,11 @@ class Heap
     // Heap manipulation operations
     void insert ( const DataType &newDataItem )    // Insert a data item
         throw ( logic_error );
+    void insert ( DataType &&newDataItem )         // Move in a data item
+        throw ( logic_error );
+    template < typename... Args >
+    void emplace ( Args&&... args )                // Construct and insert
+        throw ( logic_error );
     DataType remove () throw ( logic_error );  // Remove max priority element
     void clear ();                          // Clear heap
 
@@ -56,6 +64,10 @@ class Heap
     // Recursive helper of the showStructure() function
     void showSubtree ( int index, int level ) const;
 
+    // Restore the heap properties after dataItems[index] has changed
+    void siftUp ( int index );
+    void siftDown ( int index );
+
     // Data members
     int maxSize,   // Maximum number of elements in the heap
         size;      // Actual number of elements in the heap
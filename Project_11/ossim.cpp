@@ -11,7 +11,9 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <vector>
 #include "PriorityQueue.cpp"
+#include "../Project_7/Histogram.cpp"
 
 using namespace std;
 
@@ -52,6 +54,8 @@ int main ()
     cout << "Enter the length of time to run the simulator : ";
     cin >> simLength;
 
+    vector<Histogram> waitTimes(numPtyLevels);   // Waits per priority level
+
     for ( minute = 0 ; minute < simLength ; minute++ )
     {
         // Dequeue the first task in the queue (if any).
@@ -59,9 +63,7 @@ int main ()
         if(!taskPQ.isEmpty())
         {
             task = taskPQ.dequeue();
-            cout << "At " << minute << " dequeued : ";
-            cout << task.priority << " " << task.arrived << " " <<
-                (minute - task.arrived) << endl;
+            waitTimes[task.priority].record(minute - task.arrived);
         }
 
         // Determine the number of new tasks and add them to
@@ -89,6 +91,18 @@ int main ()
 
     }
 
+    // Report the waits per priority level and overall
+    Histogram allWaitTimes;
+    cout << endl;
+    for ( j = 0 ; j < numPtyLevels ; j++ )
+    {
+        cout << "Priority " << j << " : ";
+        waitTimes[j].showSummary();
+        allWaitTimes.merge(waitTimes[j]);
+    }
+    cout << "All tasks  : ";
+    allWaitTimes.showSummary();
+
     return 0;
 }
 
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+#include "Timer.h"
+#include "../Project_5/ListLinked.cpp"
+#include "../Project_7/QueueLinked.cpp"
+#include "../Project_9/BSTree.cpp"
+#include "../Project_11/Heap.cpp"
+
+// Number of calls made to operator new. Every deep copy of a string that is
+// too long for the small string buffer shows up here.
+static long numAllocations = 0;
+
+void* operator new(size_t size)
+{
+    ++numAllocations;
+    void* p = malloc(size);
+    if (p == NULL)
+	throw bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) throw()
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t /*size*/) throw()
+{
+    free(p);
+}
+
+// Data item with a string payload that can be stored in a BSTree (getKey) or
+// in a Heap (getPriority).
+class Record {
+  public:
+    Record() : key(0) {}
+    Record(int newKey, const string& newName) : key(newKey), name(newName) {}
+
+    int getKey() const { return key; }
+    int getPriority() const { return key; }
+
+    int key;
+    string name;
+};
+
+// Builds the payload for item i. The string is longer than the small string
+// buffer so each copy of it costs an allocation.
+string makeName(int i) {
+    return string(48, char('a' + i % 26));
+}
+
+void report(const string& name, const Timer& t, long allocations,
+	    int numValues) {
+    cout << name << ": " << t.getElapsedTime() << " seconds, ";
+    cout << double(allocations) / numValues << " allocations per item" << endl;
+}
+
+// Fills each container once with copies (insert of an lvalue) and once with
+// moves (insert of an rvalue / emplace), then empties it again.
+void testList(int numValues) {
+    for (int pass = 0; pass < 2; ++pass) {
+	List<string> testList;
+	long before = numAllocations;
+	Timer t;
+	t.start();
+	for (int i = 0; i < numValues; ++i) {
+	    string name = makeName(i);
+	    if (pass == 0)
+		testList.insert(name);
+	    else
+		testList.insert(std::move(name));
+	}
+	t.stop();
+	report(pass == 0 ? "List::insert(copy)" : "List::insert(move)", t,
+	       numAllocations - before, numValues);
+    }
+}
+
+void testQueue(int numValues) {
+    for (int pass = 0; pass < 2; ++pass) {
+	QueueLinked<string> testQueue;
+	long before = numAllocations;
+	Timer t;
+	t.start();
+	for (int i = 0; i < numValues; ++i) {
+	    string name = makeName(i);
+	    if (pass == 0)
+		testQueue.enqueue(name);
+	    else
+		testQueue.enqueue(std::move(name));
+	}
+	long junk = 0;
+	while (!testQueue.isEmpty())
+	    junk += testQueue.dequeue().size();
+	t.stop();
+	report(pass == 0 ? "QueueLinked enqueue/dequeue(copy)"
+			 : "QueueLinked enqueue/dequeue(move)", t,
+	       numAllocations - before, numValues);
+    }
+}
+
+void testHeap(int numValues) {
+    for (int pass = 0; pass < 2; ++pass) {
+	Heap<Record> testHeap(numValues);
+	long before = numAllocations;
+	Timer t;
+	t.start();
+	for (int i = 0; i < numValues; ++i) {
+	    Record record(rand(), makeName(i));
+	    if (pass == 0)
+		testHeap.insert(record);
+	    else
+		testHeap.insert(std::move(record));
+	}
+	long junk = 0;
+	while (!testHeap.isEmpty())
+	    junk += testHeap.remove().name.size();
+	t.stop();
+	report(pass == 0 ? "Heap insert/remove(copy)"
+			 : "Heap insert/remove(move)", t,
+	       numAllocations - before, numValues);
+    }
+}
+
+void testBSTree(int numValues) {
+    for (int pass = 0; pass < 2; ++pass) {
+	BSTree<Record, int> testTree;
+	long before = numAllocations;
+	Timer t;
+	t.start();
+	for (int i = 0; i < numValues; ++i) {
+	    Record record(rand(), makeName(i));
+	    if (pass == 0)
+		testTree.insert(record);
+	    else
+		testTree.insert(std::move(record));
+	}
+	t.stop();
+	report(pass == 0 ? "BSTree::insert(copy)" : "BSTree::insert(move)", t,
+	       numAllocations - before, numValues);
+    }
+}
+
+int main() {
+    cout << endl << "Enter the number of values to test: ";
+    int numValues;
+    cin >> numValues;
+
+    testList(numValues);
+    testQueue(numValues);
+    testHeap(numValues);
+    testBSTree(numValues);
+
+    return 0;
+}
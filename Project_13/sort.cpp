@@ -5,6 +5,7 @@
 using namespace std;
 
 #include "Timer.h"
+#include "../Project_7/TaskPool.cpp"     // Build with -pthread
 
 const int numSorts = 100;
 
@@ -52,6 +53,31 @@ void quickSort(vector<int>::iterator front, vector<int>::iterator back) {
     }
 }
 
+// Ranges shorter than this are not worth a task of their own
+const int parallelCutoff = 10000;
+
+// Quicksort on the shared TaskPool: partitions around the median of the
+// first, middle and last keys, sorts the smaller keys as a task while
+// sorting the larger keys itself, then waits for the task.
+void parallelSort(vector<int>::iterator front, vector<int>::iterator back) {
+    if (back - front < parallelCutoff) {
+	sort(front, back);
+	return;
+    }
+
+    int a = *front, b = *(front + (back - front) / 2), c = *(back - 1);
+    int value = max(min(a, b), min(max(a, b), c));
+    vector<int>::iterator lessEnd =
+	partition(front, back, [value](int key) { return key < value; });
+    vector<int>::iterator equalEnd =
+	partition(lessEnd, back, [value](int key) { return key == value; });
+
+    TaskGroup group;
+    group.run([front, lessEnd]() { parallelSort(front, lessEnd); });
+    parallelSort(equalEnd, back);
+    group.wait();
+}
+
 // This function takes a pointer to a sorting function that expects
 // two iterators that point to the first and last element of the list
 // to be sorted, the name of the sort routine, the list of elements to
@@ -104,6 +130,7 @@ int main(int argc, char **argv) {
     timeSort(selectionSort, "Selection sort", masterList, overhead);
     timeSort(quickSort, "Quicksort", masterList, overhead);
     timeSort(sort, "STL sort", masterList, overhead);
+    timeSort(parallelSort, "Parallel sort", masterList, overhead);
 
     return 0;
 }
@@ -27,7 +27,7 @@ using namespace std;
 template<class DataType>
 List<DataType>::List(int ignored)
 {
-    head = cursor = NULL;
+    head = tail = cursor = NULL;
 }
 
 /** The copy constructor
@@ -37,7 +37,7 @@ List<DataType>::List(int ignored)
 template<class DataType>
 List<DataType>::List(const List& other)
 {
-    head = cursor = NULL;
+    head = tail = cursor = NULL;
     ListNode* temp = other.head;
     while(temp != NULL)
     {
@@ -55,6 +55,9 @@ List<DataType>::List(const List& other)
 template<class DataType>
 List<DataType>& List<DataType>::operator=(const List& other)
 {
+    if(this == &other)
+        return *this;
+
     clear();
     ListNode* temp = other.head;
     while(temp != NULL)
@@ -65,6 +68,39 @@ List<DataType>& List<DataType>::operator=(const List& other)
     return *this;
 }
 
+/** The move constructor
+* that takes over the nodes of the other List. The other List is left empty.
+* @param other is the List whose nodes are taken over.
+*/
+template<class DataType>
+List<DataType>::List(List&& other)
+{
+    head = other.head;
+    tail = other.tail;
+    cursor = other.cursor;
+    other.head = other.tail = other.cursor = NULL;
+}
+
+/** The move assignment operator
+* that releases the nodes of this List and takes over the nodes of the other
+* List. The other List is left empty.
+* @param other is the List whose nodes are taken over.
+* @return The reference to this object.
+*/
+template<class DataType>
+List<DataType>& List<DataType>::operator=(List&& other)
+{
+    if(this == &other)
+        return *this;
+
+    clear();
+    head = other.head;
+    tail = other.tail;
+    cursor = other.cursor;
+    other.head = other.tail = other.cursor = NULL;
+    return *this;
+}
+
 /** The destructor
 * that deallocates the memory used to store the nodes in the List.
 * @see clear()
@@ -81,22 +117,53 @@ List<DataType>::~List()
 * In either case, moves the cursor to newDataItem.
 * @pre The List is not full.
 * @param newDataItem is the data to be added to the List.
-* @todo Implement exception handling and make sense of exception specifications
+* @see emplace()
 */
 template<class DataType>
 void List<DataType>::insert(const DataType& newDataItem) throw (logic_error)
+{
+    emplace(newDataItem);
+}
+
+/** Moves newDataItem into the List
+* after the cursor, or as the only data item of an empty List. In either case,
+* moves the cursor to the new data item.
+* @pre The List is not full.
+* @param newDataItem is the data to be moved into the List.
+* @see emplace()
+*/
+template<class DataType>
+void List<DataType>::insert(DataType&& newDataItem) throw (logic_error)
+{
+    emplace(std::move(newDataItem));
+}
+
+/** Constructs a new data item in place from args
+* and inserts it the same way as insert(). No temporary data item is created.
+* @pre The List is not full.
+* @param args are the constructor arguments for the new data item.
+* @todo Implement exception handling and make sense of exception specifications
+*/
+template<class DataType>
+template<typename... Args>
+void List<DataType>::emplace(Args&&... args) throw (logic_error)
 {
     if(!isFull())
+    {
         if(!isEmpty())
         {
-            cursor->next = new ListNode(newDataItem, cursor->next);
+            cursor->next = new ListNode(cursor->next,
+                std::forward<Args>(args)...);
+            if(cursor == tail)
+                tail = cursor->next;
             cursor = cursor->next;
         }
         else
         {
-            head = new ListNode(newDataItem, NULL);
-            cursor = head;
+            head = new ListNode(NULL, std::forward<Args>(args)...);
+            cursor = tail = head;
         }
+    }
 }
 
 /** Removes the data item marked by the cursor
@@ -113,18 +180,24 @@ void List<DataType>::remove()  throw (logic_error)
     if(!isEmpty())
     {
         ListNode* temp = cursor->next;
-        gotoPrior();
-        if (cursor->next == temp) //Did not go to prior
+        if (cursor == head) //No prior to relink
         {
             delete cursor;
             head = temp;
+            if(head == NULL)
+                tail = NULL;
         }
-        else //Went to prior
+        else
+        {
+            gotoPrior();
             delete cursor->next;
-        cursor->next = temp;
+            cursor->next = temp;
+            if(temp == NULL)
+                tail = cursor;
+        }
         cursor = temp;
         if(cursor == NULL)
-            gotoBeginning();
+            cursor = head;
     }
 }
 
@@ -147,11 +220,13 @@ void List<DataType>::replace(const DataType& newDataItem) throw (logic_error)
 template<class DataType>
 void List<DataType>::clear()
 {
-    while (cursor != NULL)
+    while (head != NULL)
     {
-        remove();
+        ListNode* temp = head->next;
+        delete head;
+        head = temp;
     }
-    head = cursor = NULL;
+    head = tail = cursor = NULL;
 }
 
 /** Returns true if the List is empty.
@@ -199,7 +274,7 @@ template<class DataType>
 void List<DataType>::gotoEnd() throw (logic_error)
 {
     if(!isEmpty())
-        while(gotoNext());
+        cursor = tail;
 }
 
 /** Moves the cursor the next data item.
@@ -280,6 +355,8 @@ void List<DataType>::moveToBeginning() throw (logic_error)
             ListNode* tempC = cursor;
             gotoPrior();
             cursor->next = tempN;
+            if(tempC == tail)
+                tail = cursor;
             tempC->next = head;
             cursor = head = tempC;
         }
@@ -305,8 +382,183 @@ void List<DataType>::insertBefore(const DataType& newDataItem) throw
             insert(newDataItem);
         }
         else
+        {
             head = cursor = new ListNode(newDataItem, head);
+            if(tail == NULL)
+                tail = head;
+        }
+    }
+}
+
+/** Moves every data item of the other List into this List.
+* The data items are inserted after the cursor (or make up the whole List if
+* this List is empty) and the cursor moves to the last data item moved in. The
+* nodes are relinked, not copied, so this takes constant time. The other List
+* is left empty.
+* @pre other is not this List.
+* @param other is the List whose data items are moved into this List.
+* @throw other is this List.
+*/
+template<class DataType>
+void List<DataType>::splice(List& other) throw (logic_error)
+{
+    if(this == &other)
+        throw logic_error("splice() of a List into itself");
+    if(other.isEmpty())
+        return;
+
+    if(!isEmpty())
+    {
+        other.tail->next = cursor->next;
+        cursor->next = other.head;
+        if(cursor == tail)
+            tail = other.tail;
+    }
+    else
+    {
+        head = other.head;
+        tail = other.tail;
     }
+    cursor = other.tail;
+    other.head = other.tail = other.cursor = NULL;
+}
+
+/** Moves the data items in the range [first, last) of the other List
+* into this List after the cursor (or make up the whole List if this List is
+* empty.) The cursor moves to the last data item moved in. The nodes are
+* relinked, not copied. Finding the node before first and the last node of the
+* range takes time proportional to the distance from the beginning of the
+* other List to last. If the cursor of the other List was inside the range, it
+* moves to the beginning of the other List.
+* @pre other is not this List. first and last are iterators of other, and
+* first does not come after last.
+* @param other is the List whose data items are moved into this List.
+* @param first marks the first data item to move.
+* @param last marks the data item after the last one to move.
+* @throw other is this List.
+*/
+template<class DataType>
+void List<DataType>::splice(List& other, iterator first, iterator last)
+    throw (logic_error)
+{
+    if(this == &other)
+        throw logic_error("splice() of a List into itself");
+    if(first == last)
+        return;
+
+    //Find the node before the range and the last node in the range
+    ListNode* before = NULL;
+    if(first.node != other.head)
+    {
+        before = other.head;
+        while(before->next != first.node)
+            before = before->next;
+    }
+    bool cursorMoved = false;
+    ListNode* rangeEnd = first.node;
+    while(true)
+    {
+        if(rangeEnd == other.cursor)
+            cursorMoved = true;
+        if(rangeEnd->next == last.node)
+            break;
+        rangeEnd = rangeEnd->next;
+    }
+
+    //Unlink the range from the other List
+    if(before != NULL)
+        before->next = last.node;
+    else
+        other.head = last.node;
+    if(last.node == NULL)
+        other.tail = before;
+    if(cursorMoved)
+        other.cursor = other.head;
+
+    //Link the range in after the cursor
+    if(!isEmpty())
+    {
+        rangeEnd->next = cursor->next;
+        cursor->next = first.node;
+        if(cursor == tail)
+            tail = rangeEnd;
+    }
+    else
+    {
+        rangeEnd->next = NULL;
+        head = first.node;
+        tail = rangeEnd;
+    }
+    cursor = rangeEnd;
+}
+
+/** Merges the data items of the other List into this List.
+* Both Lists must be sorted in ascending order (according to operator<) and
+* the result is sorted as well. Equal data items keep their order, with the
+* data items of this List ahead of those of the other List. Takes time
+* proportional to the combined length, relinks nodes without copying data
+* items, and leaves the other List empty. Moves the cursor to the beginning of
+* the List.
+* @pre other is not this List. Both Lists are sorted.
+* @param other is the List whose data items are merged into this List.
+* @throw other is this List.
+* @see mergeNodes()
+*/
+template<class DataType>
+void List<DataType>::merge(List& other) throw (logic_error)
+{
+    if(this == &other)
+        throw logic_error("merge() of a List into itself");
+
+    head = mergeNodes(head, other.head, tail);
+    cursor = head;
+    other.head = other.tail = other.cursor = NULL;
+}
+
+/** Sorts the data items in the List
+* in ascending order (according to operator<). The sort is a stable bottom-up
+* merge sort: it takes O(n log n) time and relinks nodes instead of copying
+* data items. Sorted runs are kept in bins of doubling size (like the digits
+* of a binary counter) so that each merge works on recently touched nodes.
+* Moves the cursor to the beginning of the List.
+* @see mergeNodes()
+*/
+template<class DataType>
+void List<DataType>::sort()
+{
+    const int MAX_BINS = 64;
+    ListNode* bins[MAX_BINS];   //bins[i] is empty or holds a run of 2^i nodes
+    int numBins = 0;
+    ListNode* last = NULL;
+
+    //Feed the nodes one at a time, carrying full bins upward
+    ListNode* remaining = head;
+    while(remaining != NULL)
+    {
+        ListNode* carry = remaining;
+        remaining = remaining->next;
+        carry->next = NULL;
+
+        int i = 0;
+        while(i < numBins && bins[i] != NULL)
+        {
+            //Older nodes are in the bin, so they go first
+            carry = mergeNodes(bins[i], carry, last);
+            bins[i] = NULL;
+            i++;
+        }
+        if(i == numBins)
+            numBins++;
+        bins[i] = carry;
+    }
+
+    //Merge what is left in the bins, from the newest to the oldest nodes
+    head = NULL;
+    tail = NULL;
+    for(int i = 0; i < numBins; i++)
+        if(bins[i] != NULL)
+            head = mergeNodes(bins[i], head, tail);
+    cursor = head;
 }
 
 /** Outputs the items in a List.
@@ -340,6 +592,286 @@ void List<DataType>::showStructure() const
     }
 }
 
+/** Returns an iterator to the first data item
+* in the List. Iterating does not move the cursor.
+* @return The iterator marking the first data item, or end() if the List is
+* empty.
+*/
+template<class DataType>
+typename List<DataType>::iterator List<DataType>::begin()
+{
+    return iterator(head);
+}
+
+/** Returns an iterator past the last data item
+* in the List.
+* @return The iterator marking the end of the List.
+*/
+template<class DataType>
+typename List<DataType>::iterator List<DataType>::end()
+{
+    return iterator(NULL);
+}
+
+/** Returns a read-only iterator to the first data item
+* in the List. Iterating does not move the cursor.
+* @return The iterator marking the first data item, or end() if the List is
+* empty.
+*/
+template<class DataType>
+typename List<DataType>::const_iterator List<DataType>::begin() const
+{
+    return const_iterator(head);
+}
+
+/** Returns a read-only iterator past the last data item
+* in the List.
+* @return The iterator marking the end of the List.
+*/
+template<class DataType>
+typename List<DataType>::const_iterator List<DataType>::end() const
+{
+    return const_iterator(NULL);
+}
+
+/** Returns a read-only iterator to the first data item
+* in the List, even if the List itself is not const.
+* @return The iterator marking the first data item.
+* @see begin()
+*/
+template<class DataType>
+typename List<DataType>::const_iterator List<DataType>::cbegin() const
+{
+    return const_iterator(head);
+}
+
+/** Returns a read-only iterator past the last data item
+* in the List, even if the List itself is not const.
+* @return The iterator marking the end of the List.
+* @see end()
+*/
+template<class DataType>
+typename List<DataType>::const_iterator List<DataType>::cend() const
+{
+    return const_iterator(NULL);
+}
+
+/** Merges two sorted chains of nodes
+* into one sorted chain. Nodes of first come ahead of equal nodes of second.
+* @param first is the first node of the first chain (may be NULL.)
+* @param second is the first node of the second chain (may be NULL.)
+* @param last is set to the last node of the merged chain.
+* @return The first node of the merged chain.
+*/
+template<class DataType>
+typename List<DataType>::ListNode* List<DataType>::mergeNodes(
+    ListNode* first, ListNode* second, ListNode*& last)
+{
+    ListNode* result = NULL;
+    ListNode** link = &result;
+    last = NULL;
+    while(first != NULL && second != NULL)
+    {
+        if(second->dataItem < first->dataItem)
+        {
+            *link = second;
+            second = second->next;
+        }
+        else
+        {
+            *link = first;
+            first = first->next;
+        }
+        last = *link;
+        link = &last->next;
+    }
+
+    //Append whichever chain is left over and find its end
+    *link = (first != NULL) ? first : second;
+    while(*link != NULL)
+    {
+        last = *link;
+        link = &last->next;
+    }
+    return result;
+}
+
+//
+// Iterator Function Implementations //////////////////////////////////////////
+//
+
+/** The parameterized constructor
+* that creates an iterator marking the data item stored in nodePtr.
+* @param nodePtr is the node to mark. NULL marks the end of the List.
+*/
+template<class DataType>
+List<DataType>::iterator::iterator(ListNode* nodePtr)
+{
+    node = nodePtr;
+}
+
+/** Returns a reference to the data item
+* marked by this iterator.
+* @pre This iterator does not mark the end of the List.
+* @return The data item marked by this iterator.
+*/
+template<class DataType>
+DataType& List<DataType>::iterator::operator*() const
+{
+    return node->dataItem;
+}
+
+/** Returns a pointer to the data item
+* marked by this iterator.
+* @pre This iterator does not mark the end of the List.
+* @return The address of the data item marked by this iterator.
+*/
+template<class DataType>
+DataType* List<DataType>::iterator::operator->() const
+{
+    return &node->dataItem;
+}
+
+/** Moves this iterator to the next data item
+* and returns it.
+* @pre This iterator does not mark the end of the List.
+* @return The reference to this iterator.
+*/
+template<class DataType>
+typename List<DataType>::iterator& List<DataType>::iterator::operator++()
+{
+    node = node->next;
+    return *this;
+}
+
+/** Moves this iterator to the next data item
+* and returns its previous value.
+* @pre This iterator does not mark the end of the List.
+* @return A copy of this iterator before it was moved.
+*/
+template<class DataType>
+typename List<DataType>::iterator List<DataType>::iterator::operator++(int)
+{
+    iterator temp = *this;
+    node = node->next;
+    return temp;
+}
+
+/** Returns true if both iterators mark the same data item.
+* Otherwise, returns false.
+* @param other is the iterator to compare against.
+* @return The iterators are equal or not.
+*/
+template<class DataType>
+bool List<DataType>::iterator::operator==(const iterator& other) const
+{
+    return (node == other.node);
+}
+
+/** Returns true if the iterators mark different data items.
+* Otherwise, returns false.
+* @param other is the iterator to compare against.
+* @return The iterators are different or not.
+*/
+template<class DataType>
+bool List<DataType>::iterator::operator!=(const iterator& other) const
+{
+    return (node != other.node);
+}
+
+/** The parameterized constructor
+* that creates a read-only iterator marking the data item stored in nodePtr.
+* @param nodePtr is the node to mark. NULL marks the end of the List.
+*/
+template<class DataType>
+List<DataType>::const_iterator::const_iterator(const ListNode* nodePtr)
+{
+    node = nodePtr;
+}
+
+/** The conversion constructor
+* that creates a read-only iterator marking the same data item as other.
+* @param other is the iterator to convert.
+*/
+template<class DataType>
+List<DataType>::const_iterator::const_iterator(const iterator& other)
+{
+    node = other.node;
+}
+
+/** Returns a read-only reference to the data item
+* marked by this iterator.
+* @pre This iterator does not mark the end of the List.
+* @return The data item marked by this iterator.
+*/
+template<class DataType>
+const DataType& List<DataType>::const_iterator::operator*() const
+{
+    return node->dataItem;
+}
+
+/** Returns a read-only pointer to the data item
+* marked by this iterator.
+* @pre This iterator does not mark the end of the List.
+* @return The address of the data item marked by this iterator.
+*/
+template<class DataType>
+const DataType* List<DataType>::const_iterator::operator->() const
+{
+    return &node->dataItem;
+}
+
+/** Moves this iterator to the next data item
+* and returns it.
+* @pre This iterator does not mark the end of the List.
+* @return The reference to this iterator.
+*/
+template<class DataType>
+typename List<DataType>::const_iterator&
+    List<DataType>::const_iterator::operator++()
+{
+    node = node->next;
+    return *this;
+}
+
+/** Moves this iterator to the next data item
+* and returns its previous value.
+* @pre This iterator does not mark the end of the List.
+* @return A copy of this iterator before it was moved.
+*/
+template<class DataType>
+typename List<DataType>::const_iterator
+    List<DataType>::const_iterator::operator++(int)
+{
+    const_iterator temp = *this;
+    node = node->next;
+    return temp;
+}
+
+/** Returns true if both iterators mark the same data item.
+* Otherwise, returns false.
+* @param other is the iterator to compare against.
+* @return The iterators are equal or not.
+*/
+template<class DataType>
+bool List<DataType>::const_iterator::operator==(
+    const const_iterator& other) const
+{
+    return (node == other.node);
+}
+
+/** Returns true if the iterators mark different data items.
+* Otherwise, returns false.
+* @param other is the iterator to compare against.
+* @return The iterators are different or not.
+*/
+template<class DataType>
+bool List<DataType>::const_iterator::operator!=(
+    const const_iterator& other) const
+{
+    return (node != other.node);
+}
+
 //
 // ListNode Function Implementations //////////////////////////////////////////
 //
@@ -352,7 +884,19 @@ void List<DataType>::showStructure() const
 */
 template<class DataType>
 List<DataType>::ListNode::ListNode(const DataType& nodeData, ListNode* nextPtr)
+    : dataItem(nodeData), next(nextPtr)
+{
+}
+
+/** The emplacing constructor
+* that constructs the ListNode's data item in place from args and sets the
+* ListNode's next pointer to the value of nextPtr.
+* @param nextPtr is the pointer to the next node that this node is linked to.
+* @param args are the constructor arguments for the data item.
+*/
+template<class DataType>
+template<typename... Args>
+List<DataType>::ListNode::ListNode(ListNode* nextPtr, Args&&... args)
+    : dataItem(std::forward<Args>(args)...), next(nextPtr)
 {
-    dataItem = nodeData;
-    next = nextPtr;
 }
\ No newline at end of file
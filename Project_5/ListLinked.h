@@ -11,18 +11,32 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <iterator>
+#include <cstddef>
+#include <utility>
 
 using namespace std;
 
 template <typename DataType>
 class List {
+  private:
+    class ListNode;
+
   public:
+    class iterator;
+    class const_iterator;
+
     List(int ignored = 0);
     List(const List& other);
+    List(List&& other);
     List& operator=(const List& other);
+    List& operator=(List&& other);
     ~List();
 
     void insert(const DataType& newDataItem) throw (logic_error);
+    void insert(DataType&& newDataItem) throw (logic_error);
+    template <typename... Args>
+    void emplace(Args&&... args) throw (logic_error);
     void remove() throw (logic_error);
     void replace(const DataType& newDataItem) throw (logic_error);
     void clear();
@@ -42,19 +56,86 @@ class List {
 
     // Programming exercise 3
     void insertBefore(const DataType& newDataItem) throw (logic_error);
+
+    // Bulk operations that relink nodes instead of copying data items
+    void splice(List& other) throw (logic_error);
+    void splice(List& other, iterator first, iterator last)
+        throw (logic_error);
+    void merge(List& other) throw (logic_error);
+    void sort();
     
     void showStructure() const;
 
+    // Iteration that leaves the cursor untouched
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    class iterator {
+      public:
+	typedef forward_iterator_tag iterator_category;
+	typedef DataType value_type;
+	typedef ptrdiff_t difference_type;
+	typedef DataType* pointer;
+	typedef DataType& reference;
+
+	iterator(ListNode* nodePtr = NULL);
+
+	DataType& operator*() const;
+	DataType* operator->() const;
+	iterator& operator++();
+	iterator operator++(int);
+	bool operator==(const iterator& other) const;
+	bool operator!=(const iterator& other) const;
+
+      private:
+	ListNode* node;
+
+	friend class const_iterator;
+	friend class List;
+    };
+
+    class const_iterator {
+      public:
+	typedef forward_iterator_tag iterator_category;
+	typedef DataType value_type;
+	typedef ptrdiff_t difference_type;
+	typedef const DataType* pointer;
+	typedef const DataType& reference;
+
+	const_iterator(const ListNode* nodePtr = NULL);
+	const_iterator(const iterator& other);
+
+	const DataType& operator*() const;
+	const DataType* operator->() const;
+	const_iterator& operator++();
+	const_iterator operator++(int);
+	bool operator==(const const_iterator& other) const;
+	bool operator!=(const const_iterator& other) const;
+
+      private:
+	const ListNode* node;
+    };
+
   private:
     class ListNode {
       public:
 	ListNode(const DataType& nodeData, ListNode* nextPtr);
+	template <typename... Args>
+	ListNode(ListNode* nextPtr, Args&&... args);
 
 	DataType dataItem;
 	ListNode* next;
     };
 
+    static ListNode* mergeNodes(ListNode* first, ListNode* second,
+        ListNode*& last);
+
     ListNode* head;
+    ListNode* tail;
     ListNode* cursor;
 
 };
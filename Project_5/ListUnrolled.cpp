@@ -0,0 +1,543 @@
+/** @file ListUnrolled.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement an unrolled linked list.
+* @details The cursor-based interface matches that of the singly linked List in
+* ListLinked.cpp. Instead of storing one data item per node, each node stores a
+* block of up to BLOCK_SIZE data items (one cache line worth of data.) Nodes
+* are linked in both directions so that the cursor can move backwards without
+* rescanning the List. A sequential scan only follows a pointer once per block
+* and the per data item memory overhead is a fraction of the linked version.
+*/
+
+//
+// HEADER FILES ///////////////////////////////////////////////////////////////
+//
+
+#include "ListUnrolled.h"
+using namespace std;
+
+//
+// ListUnrolled Function Implementations //////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty List.
+* @param ignored is provided for call compatibility with the array
+* implementation.
+*/
+template<class DataType>
+ListUnrolled<DataType>::ListUnrolled(int ignored)
+{
+    head = tail = cursor = NULL;
+    cursorIndex = 0;
+}
+
+/** The copy constructor
+* that initializes the List to be equivalent to the other List.
+* @param other is the List to be equivalent to this List.
+* @see operator=()
+*/
+template<class DataType>
+ListUnrolled<DataType>::ListUnrolled(const ListUnrolled& other)
+{
+    head = tail = cursor = NULL;
+    cursorIndex = 0;
+    *this = other;
+}
+
+/** The overloaded assignment operator
+* that sets the List to be equivalent to the other List and returns a reference
+* to this object. The blocks of the other List are copied as they are and the
+* cursor is placed on the same data item as the cursor of the other List.
+* @param other is the List that this List will be made equivalent to.
+* @return The reference to this object.
+*/
+template<class DataType>
+ListUnrolled<DataType>& ListUnrolled<DataType>::operator=(
+    const ListUnrolled& other)
+{
+    if(this == &other)
+        return *this;
+
+    clear();
+    for(ListNode* temp = other.head; temp != NULL; temp = temp->next)
+    {
+        ListNode* node = new ListNode(tail, NULL);
+        for(int i = 0; i < temp->count; i++)
+            node->dataItems[i] = temp->dataItems[i];
+        node->count = temp->count;
+
+        if(tail != NULL)
+            tail->next = node;
+        else
+            head = node;
+        tail = node;
+
+        if(temp == other.cursor)
+        {
+            cursor = node;
+            cursorIndex = other.cursorIndex;
+        }
+    }
+    return *this;
+}
+
+/** The destructor
+* that deallocates the memory used to store the nodes in the List.
+* @see clear()
+*/
+template<class DataType>
+ListUnrolled<DataType>::~ListUnrolled()
+{
+    clear();
+}
+
+/** Inserts newDataItem into the List.
+* If the List is not empty, then inserts newDataItem after the cursor.
+* Otherwise, inserts newDataItem as the first (and only) data item in the List.
+* In either case, moves the cursor to newDataItem.
+* @pre The List is not full.
+* @param newDataItem is the data to be added to the List.
+* @see insertAt()
+*/
+template<class DataType>
+void ListUnrolled<DataType>::insert(const DataType& newDataItem)
+    throw (logic_error)
+{
+    if(!isFull())
+    {
+        if(!isEmpty())
+            insertAt(newDataItem, cursorIndex + 1);
+        else
+        {
+            head = tail = cursor = new ListNode(NULL, NULL);
+            cursor->dataItems[0] = newDataItem;
+            cursor->count = 1;
+            cursorIndex = 0;
+        }
+    }
+}
+
+/** Removes the data item marked by the cursor
+* from the List. If the resulting List is not empty, then moves the cursor to
+* the data item that followed the deleted data item. If the deleted data item
+* was at the end of the List, then moves the cursor to the beginning of the
+* List. A node left less than half full borrows data items from or is merged
+* with a neighbouring node.
+* @pre The List is not empty.
+* @see refill()
+*/
+template<class DataType>
+void ListUnrolled<DataType>::remove() throw (logic_error)
+{
+    if(!isEmpty())
+    {
+        ListNode* node = cursor;
+
+        //Close the gap left by the removed data item
+        for(int i = cursorIndex + 1; i < node->count; i++)
+            node->dataItems[i - 1] = node->dataItems[i];
+        node->count--;
+
+        //Move the cursor to the data item that followed the removed one
+        if(cursorIndex == node->count)
+        {
+            cursor = (node->next != NULL) ? node->next : head;
+            cursorIndex = 0;
+        }
+
+        if(node->count == 0 || node->count < BLOCK_SIZE / 2)
+            refill(node);
+    }
+}
+
+/** Replaces the data item marked by the cursor
+* with newDataItem. The cursor remains at newDataItem.
+* @pre The List is not empty.
+* @param newDataItem is the data that will replace the data at the cursor.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::replace(const DataType& newDataItem)
+    throw (logic_error)
+{
+    if(!isEmpty())
+        cursor->dataItems[cursorIndex] = newDataItem;
+}
+
+/** Removes all the data items in the List.
+* Will deallocate memory used for the nodes to store the data.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::clear()
+{
+    while(head != NULL)
+    {
+        ListNode* temp = head->next;
+        delete head;
+        head = temp;
+    }
+    head = tail = cursor = NULL;
+    cursorIndex = 0;
+}
+
+/** Returns true if the List is empty.
+* Otherwise, returns false.
+* @return The List is empty or not.
+*/
+template<class DataType>
+bool ListUnrolled<DataType>::isEmpty() const
+{
+    return (head == NULL);
+}
+
+/** Returns true if the List is full.
+* Otherwise, returns false.
+* @todo Will always return false, check if memory can be allocated.
+* @return The List is full or not.
+*/
+template<class DataType>
+bool ListUnrolled<DataType>::isFull() const
+{
+    return false;
+}
+
+/** Moves the cursor to the beginning
+* of the List.
+* @pre The List is not empty.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::gotoBeginning() throw (logic_error)
+{
+    if(!isEmpty())
+    {
+        cursor = head;
+        cursorIndex = 0;
+    }
+}
+
+/** Moves the cursor to the end
+* of the List.
+* @pre The List is not empty.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::gotoEnd() throw (logic_error)
+{
+    if(!isEmpty())
+    {
+        cursor = tail;
+        cursorIndex = tail->count - 1;
+    }
+}
+
+/** Moves the cursor the next data item.
+* If the cursor is not at the end of the List, the cursor moves to the next
+* data item and returns true. Otherwise, returns false.
+* @pre The List is not empty.
+* @return The cursor was not at the end of the List.
+*/
+template<class DataType>
+bool ListUnrolled<DataType>::gotoNext() throw (logic_error)
+{
+    if(!isEmpty())
+    {
+        if(cursorIndex + 1 < cursor->count)
+        {
+            cursorIndex++;
+            return true;
+        }
+        if(cursor->next != NULL)
+        {
+            cursor = cursor->next;
+            cursorIndex = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Moves the cursor to the preceding data item.
+* If the cursor is not at the beginning of the List, the cursor moves to the
+* preceding data item and returns true. Otherwise, returns false. As with the
+* linked List, an empty List returns true.
+* @pre The List is not empty.
+* @return The cursor was not at the beginning of the List.
+*/
+template<class DataType>
+bool ListUnrolled<DataType>::gotoPrior() throw (logic_error)
+{
+    if(!isEmpty())
+    {
+        if(cursorIndex > 0)
+        {
+            cursorIndex--;
+            return true;
+        }
+        if(cursor->prior != NULL)
+        {
+            cursor = cursor->prior;
+            cursorIndex = cursor->count - 1;
+            return true;
+        }
+        return false;
+    }
+    return true;
+}
+
+/** Returns the value of the data item
+* marked by the cursor.
+* @pre The List is not empty.
+* @return The data item marked by the cursor.
+*/
+template<class DataType>
+DataType ListUnrolled<DataType>::getCursor() const throw (logic_error)
+{
+    if(!isEmpty())
+        return cursor->dataItems[cursorIndex];
+    return (DataType)NULL;
+}
+
+//Exercise 2
+/** Removes and reinserts the data item
+* marked by the cursor to the beginning of the List. Moves the cursor to the
+* beginning of the List.
+* @pre The List is not empty.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::moveToBeginning() throw (logic_error)
+{
+    if(!isEmpty())
+    {
+        if(cursor != head || cursorIndex != 0)
+        {
+            DataType temp = cursor->dataItems[cursorIndex];
+            remove();
+            cursor = head;
+            insertAt(temp, 0);
+        }
+    }
+}
+
+//Exercise 3
+/** Inserts newDataItem into a List.
+* If the List is not empty, then inserts newDataItem immediately before the
+* cursor. Otherwise, inserts newDataItem as the first (and only) data item in
+* the List. In either case, moves the cursor to newDataItem.
+* @pre The List is not full.
+* @see insertAt()
+*/
+template<class DataType>
+void ListUnrolled<DataType>::insertBefore(const DataType& newDataItem) throw
+    (logic_error)
+{
+    if(!isFull())
+    {
+        if(!isEmpty())
+            insertAt(newDataItem, cursorIndex);
+        else
+            insert(newDataItem);
+    }
+}
+
+/** Outputs the items in a List.
+* If the List is empty, outputs "Empty list." This operation is intended for
+* testing and debugging purposes only.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::showStructure() const
+{
+    if ( isEmpty() )
+    {
+       cout << "Empty list" << endl;
+    }
+    else
+    {
+    for (ListNode* temp = head; temp != 0; temp = temp->next) {
+        for (int i = 0; i < temp->count; i++) {
+        if (temp == cursor && i == cursorIndex) {
+        cout << "[";
+        }
+
+        // Assumes that dataItem can be printed via << because
+        // is is either primitive or operator<< is overloaded.
+        cout << temp->dataItems[i];
+
+        if (temp == cursor && i == cursorIndex) {
+        cout << "]";
+        }
+        cout << " ";
+        }
+    }
+    cout << endl;
+    }
+}
+
+/** Inserts newDataItem at position within the node marked by the cursor.
+* A full node is split in two first: inserting past its last data item starts a
+* new node (so that appending fills every block), otherwise the upper half of
+* the block moves into a new node that follows it. Moves the cursor to
+* newDataItem.
+* @pre The List is not empty.
+* @param newDataItem is the data to be added to the List.
+* @param position is the index within the cursor's node to insert at.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::insertAt(const DataType& newDataItem,
+    int position)
+{
+    ListNode* node = cursor;
+    if(node->count == BLOCK_SIZE)
+    {
+        ListNode* newNode = new ListNode(node, node->next);
+        if(node->next != NULL)
+            node->next->prior = newNode;
+        else
+            tail = newNode;
+        node->next = newNode;
+
+        if(position == BLOCK_SIZE)
+        {
+            node = newNode;
+            position = 0;
+        }
+        else
+        {
+            int half = BLOCK_SIZE / 2;
+            for(int i = half; i < BLOCK_SIZE; i++)
+                newNode->dataItems[i - half] = node->dataItems[i];
+            newNode->count = BLOCK_SIZE - half;
+            node->count = half;
+            if(position > half)
+            {
+                node = newNode;
+                position -= half;
+            }
+        }
+    }
+
+    //Open a gap for the new data item
+    for(int i = node->count; i > position; i--)
+        node->dataItems[i] = node->dataItems[i - 1];
+    node->dataItems[position] = newDataItem;
+    node->count++;
+
+    cursor = node;
+    cursorIndex = position;
+}
+
+/** Refills node after a data item was removed from it.
+* The node and a neighbouring node are merged if all of their data items fit
+* into a single block. Otherwise, the data items are shared evenly between
+* them, so both are at least half full. A node without neighbours is only
+* deleted once it is empty. The cursor stays on the same data item.
+* @param node is the node that is less than half full.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::refill(ListNode* node)
+{
+    ListNode* left = node;
+    ListNode* right = node->next;
+    if(right == NULL)
+    {
+        right = node;
+        left = node->prior;
+    }
+    if(left == NULL)
+    {
+        if(node->count == 0)
+        {
+            unlink(node);
+            delete node;
+            cursor = NULL;
+            cursorIndex = 0;
+        }
+        return;
+    }
+
+    int total = left->count + right->count;
+    if(total <= BLOCK_SIZE)
+    {
+        //Merge the right node into the left node
+        for(int i = 0; i < right->count; i++)
+            left->dataItems[left->count + i] = right->dataItems[i];
+        if(cursor == right)
+        {
+            cursor = left;
+            cursorIndex += left->count;
+        }
+        left->count = total;
+        unlink(right);
+        delete right;
+    }
+    else if(left->count > total / 2)
+    {
+        //Move the last data items of the left node to the right node
+        int moved = left->count - total / 2;
+        for(int i = right->count - 1; i >= 0; i--)
+            right->dataItems[i + moved] = right->dataItems[i];
+        for(int i = 0; i < moved; i++)
+            right->dataItems[i] = left->dataItems[total / 2 + i];
+        left->count -= moved;
+        right->count += moved;
+        if(cursor == right)
+            cursorIndex += moved;
+        else if(cursor == left && cursorIndex >= left->count)
+        {
+            cursor = right;
+            cursorIndex -= left->count;
+        }
+    }
+    else
+    {
+        //Move the first data items of the right node to the left node
+        int moved = total / 2 - left->count;
+        for(int i = 0; i < moved; i++)
+            left->dataItems[left->count + i] = right->dataItems[i];
+        for(int i = moved; i < right->count; i++)
+            right->dataItems[i - moved] = right->dataItems[i];
+        if(cursor == right && cursorIndex < moved)
+        {
+            cursor = left;
+            cursorIndex += left->count;
+        }
+        else if(cursor == right)
+            cursorIndex -= moved;
+        left->count += moved;
+        right->count -= moved;
+    }
+}
+
+/** Removes node from the chain of nodes
+* without deallocating it. Updates head and tail if necessary.
+* @param node is the node to unlink from the List.
+*/
+template<class DataType>
+void ListUnrolled<DataType>::unlink(ListNode* node)
+{
+    if(node->prior != NULL)
+        node->prior->next = node->next;
+    else
+        head = node->next;
+    if(node->next != NULL)
+        node->next->prior = node->prior;
+    else
+        tail = node->prior;
+}
+
+//
+// ListNode Function Implementations //////////////////////////////////////////
+//
+
+/** The parameterized constructor
+* that creates an empty block linked between priorPtr and nextPtr.
+* @param priorPtr is the pointer to the node that precedes this node.
+* @param nextPtr is the pointer to the next node that this node is linked to.
+*/
+template<class DataType>
+ListUnrolled<DataType>::ListNode::ListNode(ListNode* priorPtr,
+    ListNode* nextPtr)
+{
+    count = 0;
+    prior = priorPtr;
+    next = nextPtr;
+}
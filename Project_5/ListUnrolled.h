@@ -0,0 +1,76 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 5                                        ListUnrolled.h
+//
+//  Class declaration for the unrolled linked implementation of the
+//  List ADT -- each node stores a cache-line-sized block of data items
+//
+//--------------------------------------------------------------------
+
+#ifndef LISTUNROLLED_H
+#define LISTUNROLLED_H
+
+#include <stdexcept>
+#include <iostream>
+
+using namespace std;
+
+template <typename DataType>
+class ListUnrolled {
+  public:
+    // Number of bytes of data items stored in each node
+    static const int BLOCK_BYTES = 64;
+    // Number of data items stored in each node
+    static const int BLOCK_SIZE = (sizeof(DataType) < BLOCK_BYTES) ?
+        int(BLOCK_BYTES / sizeof(DataType)) : 1;
+
+    ListUnrolled(int ignored = 0);
+    ListUnrolled(const ListUnrolled& other);
+    ListUnrolled& operator=(const ListUnrolled& other);
+    ~ListUnrolled();
+
+    void insert(const DataType& newDataItem) throw (logic_error);
+    void remove() throw (logic_error);
+    void replace(const DataType& newDataItem) throw (logic_error);
+    void clear();
+
+    bool isEmpty() const;
+    bool isFull() const;
+
+    void gotoBeginning() throw (logic_error);
+    void gotoEnd() throw (logic_error);
+    bool gotoNext() throw (logic_error);
+    bool gotoPrior() throw (logic_error);
+
+    DataType getCursor() const throw (logic_error);
+
+    // Programming exercise 2
+    void moveToBeginning () throw (logic_error);
+
+    // Programming exercise 3
+    void insertBefore(const DataType& newDataItem) throw (logic_error);
+
+    void showStructure() const;
+
+  private:
+    class ListNode {
+      public:
+	ListNode(ListNode* priorPtr, ListNode* nextPtr);
+
+	DataType dataItems[BLOCK_SIZE];
+	int count;
+	ListNode* prior;
+	ListNode* next;
+    };
+
+    void insertAt(const DataType& newDataItem, int position);
+    void refill(ListNode* node);
+    void unlink(ListNode* node);
+
+    ListNode* head;
+    ListNode* tail;
+    ListNode* cursor;
+    int cursorIndex;
+};
+
+#endif
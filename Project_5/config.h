@@ -6,4 +6,5 @@
 #define LAB5_TEST1	0	// 1 means test with int instead of char
 #define LAB5_TEST2	1	// Activate moveToBeginning (prog exercise 2)
 #define LAB5_TEST3	1	// Activate insertBefore (prog exercise 3)
+#define LAB5_TEST4	0	// 1 means test the unrolled implementation
 
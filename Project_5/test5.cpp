@@ -8,7 +8,11 @@
 
 #include <iostream>
 #include "config.h"
-#include "ListLinked.cpp"
+#if LAB5_TEST4
+#   include "ListUnrolled.cpp"
+#else
+#   include "ListLinked.cpp"
+#endif
 
 using namespace std;
 
@@ -17,10 +21,18 @@ void print_help();
 int  main()
 {
 #if LAB5_TEST1
+#   if LAB5_TEST4
+    ListUnrolled<int> testList;    // Test list
+#   else
     List<int> testList;    // Test list
+#   endif
     int testData;          // List data item
 #else
+#   if LAB5_TEST4
+    ListUnrolled<char> testList;   // Test list
+#   else
     List<char> testList;   // Test list
+#   endif
     char testData;         // List data item
 #endif
     char cmd;              // Input command
@@ -0,0 +1,180 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 5                                          timelist.cpp
+//
+//  Compares the linked and unrolled implementations of the List ADT
+//
+//--------------------------------------------------------------------
+
+#include <iostream>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+#include "ListLinked.cpp"
+#include "ListUnrolled.cpp"
+#include "../Project_13/Timer.cpp"
+
+const int numScans = 20;
+
+// Running total of the bytes requested from operator new. Used to report
+// the memory each implementation needs per data item.
+static size_t bytesAllocated = 0;
+
+void* operator new(size_t size)
+{
+    bytesAllocated += size;
+    void* p = malloc(size);
+    if (p == NULL)
+        throw bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) throw()
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t /*size*/) throw()
+{
+    free(p);
+}
+
+// Builds a list of numValues data items, then repeatedly walks it from the
+// beginning to the end with the cursor.
+template <typename ListType, typename DataType>
+void timeList(int numValues, const string& name)
+{
+    size_t bytesBefore = bytesAllocated;
+    ListType testList;
+
+    Timer build;
+    build.start();
+    for (int i = 0; i < numValues; ++i) {
+	testList.insert(DataType(i));
+    }
+    build.stop();
+    size_t bytesUsed = bytesAllocated - bytesBefore;
+
+    long junk = 0;
+    Timer scan;
+    scan.start();
+    for (int i = 0; i < numScans; ++i) {
+	testList.gotoBeginning();
+	do {
+	    junk += testList.getCursor();
+	} while (testList.gotoNext());
+    }
+    scan.stop();
+
+    cout << name << endl;
+    cout << "  Insert duration : " << build.getElapsedTime() << endl;
+    cout << "  Scan duration   : " << scan.getElapsedTime() << endl;
+    cout << "  Bytes per item  : " << double(bytesUsed) / numValues << endl;
+    cout << "  (checksum " << junk << ")" << endl;
+}
+
+// Walks a List with const_iterators instead of the cursor. The scan neither
+// copies the data items nor changes the cursor of the List.
+template <typename DataType>
+void timeIterators(int numValues, const string& name)
+{
+    List<DataType> testList;
+    for (int i = 0; i < numValues; ++i) {
+	testList.insert(DataType(i));
+    }
+    const List<DataType>& constList = testList;
+
+    long junk = 0;
+    Timer loop;
+    loop.start();
+    for (int i = 0; i < numScans; ++i) {
+	for (const DataType& item : constList) {
+	    junk += item;
+	}
+    }
+    loop.stop();
+
+    Timer algorithm;
+    algorithm.start();
+    for (int i = 0; i < numScans; ++i) {
+	junk += accumulate(constList.begin(), constList.end(), 0L);
+    }
+    algorithm.stop();
+
+    cout << name << " (iterators)" << endl;
+    cout << "  Range-for duration  : " << loop.getElapsedTime() << endl;
+    cout << "  accumulate duration : " << algorithm.getElapsedTime() << endl;
+    cout << "  (checksum " << junk << ")" << endl;
+}
+
+// Times the bulk operations: sorting a List by relinking its nodes (against
+// copying it into a vector, sorting that and copying it back), merging two
+// sorted Lists and splicing one List onto another.
+void timeBulk(int numValues)
+{
+    List<int> first, second;
+    for (int i = 0; i < numValues; ++i) {
+	first.insert(rand());
+	second.insert(rand());
+    }
+    List<int> copy = first;
+
+    Timer sortList;
+    sortList.start();
+    first.sort();
+    second.sort();
+    sortList.stop();
+
+    Timer sortVector;
+    sortVector.start();
+    vector<int> items(copy.begin(), copy.end());
+    stable_sort(items.begin(), items.end());
+    copy.clear();
+    for (size_t i = 0; i < items.size(); ++i) {
+	copy.insert(items[i]);
+    }
+    sortVector.stop();
+
+    Timer merge;
+    merge.start();
+    first.merge(second);
+    merge.stop();
+    bool sorted = is_sorted(first.begin(), first.end());
+
+    second = copy;
+    Timer splice;
+    splice.start();
+    first.gotoEnd();
+    first.splice(second);
+    splice.stop();
+
+    cout << "List<int> (bulk operations)" << endl;
+    cout << "  List::sort x2 duration   : " << sortList.getElapsedTime() << endl;
+    cout << "  vector stable_sort dur.  : " << sortVector.getElapsedTime() << endl;
+    cout << "  List::merge duration     : " << merge.getElapsedTime() << endl;
+    cout << "  List::splice duration    : " << splice.getElapsedTime() << endl;
+    cout << "  (sorted " << sorted << ")" << endl;
+}
+
+#define runTest(List, Type) timeList<List<Type>, Type>(numValues, #List "<" #Type ">")
+
+int main() {
+    cout << endl << "Enter the number of values to test: ";
+    int numValues;
+    cin >> numValues;
+
+    runTest(List, char);
+    runTest(ListUnrolled, char);
+    runTest(List, int);
+    runTest(ListUnrolled, int);
+    timeIterators<char>(numValues, "List<char>");
+    timeIterators<int>(numValues, "List<int>");
+    timeBulk(numValues);
+
+    return 0;
+}
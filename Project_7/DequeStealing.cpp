@@ -0,0 +1,222 @@
+/** @file DequeStealing.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement a work-stealing deque.
+* @details This is the Chase-Lev deque. One thread owns the deque and pushes
+* and pops data items at the bottom, like putFront() and getRear() on the same
+* end, without any lock and almost always without a compare-and-swap. Any
+* other thread may steal the data item at the top. A compare-and-swap on top
+* settles the race between two thieves, or between a thief and the owner
+* taking the last data item.
+* \n The data items live in a circular array that the owner replaces by one of
+* twice the size when it is full. A thief may still be reading the old array,
+* so old arrays are only deleted with the deque. Data items are copied with
+* plain atomic loads and stores, so DataType must be trivially copyable;
+* pointers to tasks are the intended use.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "DequeStealing.h"
+using namespace std;
+
+//
+// DequeStealing Function Implementations //////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty deque with room for initialCapacity data items, rounded
+* up to a power of two. It grows as needed.
+* @param initialCapacity is the number of data items to allocate memory for.
+*/
+template<class DataType>
+DequeStealing<DataType>::DequeStealing(int initialCapacity)
+{
+    long capacity = 2;
+    while(capacity < initialCapacity)
+        capacity *= 2;
+
+    top.store(0, memory_order_relaxed);
+    bottom.store(0, memory_order_relaxed);
+    array.store(new CircularArray(capacity), memory_order_relaxed);
+}
+
+/** The destructor
+* that deallocates the current array and every array the deque has outgrown.
+* @pre No other thread is using the deque.
+*/
+template<class DataType>
+DequeStealing<DataType>::~DequeStealing()
+{
+    delete array.load(memory_order_relaxed);
+    for(size_t i = 0; i < oldArrays.size(); i++)
+        delete oldArrays[i];
+}
+
+/** Inserts newDataItem
+* at the bottom of the deque, growing the array if it is full.
+* @pre Called by the owner thread.
+* @param newDataItem is the data to be added to the deque.
+*/
+template<class DataType>
+void DequeStealing<DataType>::push(const DataType& newDataItem)
+{
+    long b = bottom.load(memory_order_relaxed);
+    long t = top.load(memory_order_acquire);
+    CircularArray* a = array.load(memory_order_relaxed);
+    if(b - t > a->capacity - 1)
+    {
+        oldArrays.push_back(a);
+        a = a->grow(t, b);
+        array.store(a, memory_order_release);
+    }
+    a->put(b, newDataItem);
+    //Publish the data item with the new bottom
+    bottom.store(b + 1, memory_order_release);
+}
+
+/** Removes the data item
+* that was most recently pushed into dataItem.
+* @pre Called by the owner thread.
+* @param dataItem is set to the data removed from the deque.
+* @return True if a data item was removed. False if the deque was empty, or a
+* thief stole its last data item.
+*/
+template<class DataType>
+bool DequeStealing<DataType>::pop(DataType& dataItem)
+{
+    long b = bottom.load(memory_order_relaxed) - 1;
+    CircularArray* a = array.load(memory_order_relaxed);
+    //Reserve the bottom data item before looking at top
+    bottom.store(b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long t = top.load(memory_order_relaxed);
+
+    bool found = true;
+    if(t <= b)
+    {
+        dataItem = a->get(b);
+        if(t == b)
+        {
+            //Last data item: race the thieves for it
+            if(!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst,
+                memory_order_relaxed))
+                found = false;
+            bottom.store(b + 1, memory_order_relaxed);
+        }
+    }
+    else
+    {
+        found = false;
+        bottom.store(b + 1, memory_order_relaxed);
+    }
+    return found;
+}
+
+/** Removes the data item
+* that was least recently pushed into dataItem. Safe to call from any thread.
+* @param dataItem is set to the data removed from the deque.
+* @return True if a data item was removed. False if the deque was empty or
+* another thread took the data item first.
+*/
+template<class DataType>
+bool DequeStealing<DataType>::steal(DataType& dataItem)
+{
+    long t = top.load(memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = bottom.load(memory_order_acquire);
+    if(t >= b)
+        return false;
+
+    CircularArray* a = array.load(memory_order_acquire);
+    dataItem = a->get(t);
+    return top.compare_exchange_strong(t, t + 1, memory_order_seq_cst,
+        memory_order_relaxed);
+}
+
+/** Returns true if the deque is empty.
+* Otherwise, returns false. Only a snapshot while other threads are running.
+* @return The deque is empty or not.
+*/
+template<class DataType>
+bool DequeStealing<DataType>::isEmpty() const
+{
+    return (getLength() == 0);
+}
+
+/** Returns the number of data items
+* in the deque. Only a snapshot while other threads are running.
+* @return int is the number of data items in the deque.
+*/
+template<class DataType>
+int DequeStealing<DataType>::getLength() const
+{
+    long b = bottom.load(memory_order_relaxed);
+    long t = top.load(memory_order_relaxed);
+    return (b > t) ? int(b - t) : 0;
+}
+
+//
+// CircularArray Function Implementations //////////////////////////////////////
+//
+
+/** The parameterized constructor
+* that creates an array of capacity data items.
+* @param capacity is a power of two.
+*/
+template<class DataType>
+DequeStealing<DataType>::CircularArray::CircularArray(long capacity)
+{
+    this->capacity = capacity;
+    dataItems = new atomic<DataType>[capacity];
+}
+
+/** The destructor
+* that deallocates the data items.
+*/
+template<class DataType>
+DequeStealing<DataType>::CircularArray::~CircularArray()
+{
+    delete[] dataItems;
+}
+
+/** Returns the data item
+* at index, which wraps around the end of the array.
+* @param index is a position in the deque.
+* @return DataType is the data item at index.
+*/
+template<class DataType>
+DataType DequeStealing<DataType>::CircularArray::get(long index) const
+{
+    return dataItems[index & (capacity - 1)].load(memory_order_relaxed);
+}
+
+/** Stores dataItem
+* at index, which wraps around the end of the array.
+* @param index is a position in the deque.
+* @param dataItem is the data item to be stored.
+*/
+template<class DataType>
+void DequeStealing<DataType>::CircularArray::put(long index,
+    const DataType& dataItem)
+{
+    dataItems[index & (capacity - 1)].store(dataItem, memory_order_relaxed);
+}
+
+/** Returns a new array
+* of twice the capacity holding the data items from top to bottom.
+* @param top is the position of the first data item.
+* @param bottom is the position after the last data item.
+* @return CircularArray* is the new array.
+*/
+template<class DataType>
+typename DequeStealing<DataType>::CircularArray*
+    DequeStealing<DataType>::CircularArray::grow(long top, long bottom) const
+{
+    CircularArray* newArray = new CircularArray(capacity * 2);
+    for(long i = top; i < bottom; i++)
+        newArray->put(i, get(i));
+    return newArray;
+}
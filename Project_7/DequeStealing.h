@@ -0,0 +1,59 @@
+// DequeStealing.h
+
+#ifndef DEQUESTEALING_H
+#define DEQUESTEALING_H
+
+#include <atomic>
+#include <vector>
+#include <type_traits>
+
+using namespace std;
+
+template <typename DataType>
+class DequeStealing {
+    static_assert(is_trivially_copyable<DataType>::value,
+		  "DequeStealing holds trivially copyable data items, "
+		  "such as pointers to tasks");
+
+  public:
+    static const int DEFAULT_CAPACITY = 64;
+
+    DequeStealing(int initialCapacity = DEFAULT_CAPACITY);
+    ~DequeStealing();
+
+    // Owner thread only: push and pop at the bottom
+    void push(const DataType& newDataItem);
+    bool pop(DataType& dataItem);
+
+    // Any thread: take the data item at the top
+    bool steal(DataType& dataItem);
+
+    bool isEmpty() const;
+    int getLength() const;
+
+  private:
+    // Shared between threads, so copying is not supported
+    DequeStealing(const DequeStealing& other);
+    DequeStealing& operator=(const DequeStealing& other);
+
+    class CircularArray {
+      public:
+	CircularArray(long capacity);
+	~CircularArray();
+
+	DataType get(long index) const;
+	void put(long index, const DataType& dataItem);
+	CircularArray* grow(long top, long bottom) const;
+
+	long capacity;          // Power of two
+	atomic<DataType>* dataItems;
+    };
+
+    atomic<long> top;           // Next index to steal from
+    atomic<long> bottom;        // Next index to push to
+    atomic<CircularArray*> array;
+    vector<CircularArray*> oldArrays;   // Kept until destruction, since a
+					// thief may still be reading them
+};
+
+#endif	// ifndef DEQUESTEALING_H
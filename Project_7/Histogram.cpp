@@ -0,0 +1,196 @@
+/** @file Histogram.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will record a stream of non-negative values, such as
+* waiting times, and report their mean and percentiles.
+* @details Every power of two is split into SUB_BUCKETS equal buckets, so a
+* percentile is reported within about 3% of the true value while the whole
+* Histogram is a fixed array of counts. record() only computes a bucket and
+* increments it, so recording costs the same whether one value or a billion
+* values have been seen. Values below 2^MIN_EXPONENT, including zero, share
+* bucket 0. The count, mean, minimum and maximum are exact.
+* \n Histograms can be merged, so every thread of a parallel program can
+* record into its own Histogram and merge them once at the end.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "Histogram.h"
+#include <cmath>
+
+using namespace std;
+
+//
+// HISTOGRAM FUNCTION IMPLEMENTATIONS //////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty Histogram.
+*/
+Histogram::Histogram()
+{
+    clear();
+}
+
+/** Records value.
+* Negative values are recorded as zero.
+* @param value is the value to be recorded.
+*/
+void Histogram::record(double value)
+{
+    if(value < 0)
+        value = 0;
+    counts[bucketIndex(value)]++;
+    if(count == 0 || value < minValue)
+        minValue = value;
+    if(count == 0 || value > maxValue)
+        maxValue = value;
+    count++;
+    sum += value;
+}
+
+/** Adds the values recorded by other
+* to this Histogram.
+* @param other is the Histogram to be merged into this Histogram.
+*/
+void Histogram::merge(const Histogram& other)
+{
+    if(other.count == 0)
+        return;
+    for(int i = 0; i < NUM_BUCKETS; i++)
+        counts[i] += other.counts[i];
+    if(count == 0 || other.minValue < minValue)
+        minValue = other.minValue;
+    if(count == 0 || other.maxValue > maxValue)
+        maxValue = other.maxValue;
+    count += other.count;
+    sum += other.sum;
+}
+
+/** Removes all recorded values.
+*/
+void Histogram::clear()
+{
+    for(int i = 0; i < NUM_BUCKETS; i++)
+        counts[i] = 0;
+    count = 0;
+    sum = minValue = maxValue = 0;
+}
+
+/** Returns the number of values
+* recorded.
+* @return long is the number of values recorded.
+*/
+long Histogram::getCount() const
+{
+    return count;
+}
+
+/** Returns the mean
+* of the recorded values, or zero if no value has been recorded.
+* @return double is the mean of the recorded values.
+*/
+double Histogram::getMean() const
+{
+    return (count > 0) ? sum / count : 0.0;
+}
+
+/** Returns the smallest value
+* recorded, or zero if no value has been recorded.
+* @return double is the smallest value recorded.
+*/
+double Histogram::getMin() const
+{
+    return minValue;
+}
+
+/** Returns the largest value
+* recorded, or zero if no value has been recorded.
+* @return double is the largest value recorded.
+*/
+double Histogram::getMax() const
+{
+    return maxValue;
+}
+
+/** Returns the value below which
+* percent percent of the recorded values fall. The result is the lower edge of
+* the bucket holding that value, kept within the smallest and largest values
+* recorded.
+* @param percent is the percentile to be returned, from 0 to 100.
+* @return double is the percentile, or zero if no value has been recorded.
+*/
+double Histogram::getPercentile(double percent) const
+{
+    if(count == 0)
+        return 0.0;
+
+    //Rank of the value wanted, counting from 1
+    long rank = long(ceil(percent / 100.0 * count));
+    if(rank < 1)
+        rank = 1;
+    if(rank > count)
+        rank = count;
+
+    long seen = 0;
+    int index = 0;
+    while((seen += counts[index]) < rank)
+        index++;
+
+    double value = bucketValue(index);
+    if(value < minValue)
+        value = minValue;
+    if(value > maxValue)
+        value = maxValue;
+    return value;
+}
+
+/** Outputs the count, mean,
+* 50th, 90th, 99th and 99.9th percentiles and the maximum on one line.
+*/
+void Histogram::showSummary() const
+{
+    cout << "count " << count
+        << "  mean " << getMean()
+        << "  p50 " << getPercentile(50)
+        << "  p90 " << getPercentile(90)
+        << "  p99 " << getPercentile(99)
+        << "  p999 " << getPercentile(99.9)
+        << "  max " << maxValue << endl;
+}
+
+/** Returns the bucket
+* that value is counted in.
+* @param value is a non-negative value.
+* @return int is the index of the bucket.
+*/
+int Histogram::bucketIndex(double value) const
+{
+    //value = fraction * 2^exponent with 0.5 <= fraction < 1
+    int exponent;
+    double fraction = frexp(value, &exponent);
+    if(value == 0 || exponent <= MIN_EXPONENT)
+        return 0;
+    if(exponent > MIN_EXPONENT + NUM_EXPONENTS)
+        return NUM_BUCKETS - 1;
+
+    int subBucket = int((fraction - 0.5) * 2 * SUB_BUCKETS);
+    return (exponent - MIN_EXPONENT - 1) * SUB_BUCKETS + subBucket + 1;
+}
+
+/** Returns the smallest value
+* counted in the bucket at index.
+* @param index is the index of the bucket.
+* @return double is the lower edge of the bucket.
+*/
+double Histogram::bucketValue(int index) const
+{
+    if(index == 0)
+        return 0.0;
+
+    int exponent = (index - 1) / SUB_BUCKETS + MIN_EXPONENT + 1;
+    int subBucket = (index - 1) % SUB_BUCKETS;
+    return ldexp(0.5 + subBucket / (2.0 * SUB_BUCKETS), exponent);
+}
@@ -0,0 +1,42 @@
+// Histogram.h
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <iostream>
+
+using namespace std;
+
+class Histogram {
+  public:
+    Histogram();
+
+    void record(double value);
+    void merge(const Histogram& other);
+    void clear();
+
+    long getCount() const;
+    double getMean() const;
+    double getMin() const;
+    double getMax() const;
+    double getPercentile(double percent) const;
+
+    void showSummary() const;
+
+  private:
+    static const int SUB_BUCKETS = 32;      // Buckets per power of two
+    static const int MIN_EXPONENT = -16;    // Smaller values count as zero
+    static const int NUM_EXPONENTS = 64;
+    static const int NUM_BUCKETS = NUM_EXPONENTS * SUB_BUCKETS + 1;
+
+    int bucketIndex(double value) const;
+    double bucketValue(int index) const;
+
+    long counts[NUM_BUCKETS];   // Bucket 0 holds the zeros
+    long count;
+    double sum;
+    double minValue;
+    double maxValue;
+};
+
+#endif	// ifndef HISTOGRAM_H
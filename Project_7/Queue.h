@@ -5,6 +5,11 @@
 //  Class declaration of the abstract class interface to be used as
 //  the basis for implementations of the Queue ADT.
 //
+//  The implementations are declared final, so code that holds a
+//  concrete queue (or takes the queue type as a template parameter)
+//  calls them directly and can inline them. Go through Queue<DataType>&
+//  only where the implementation must be chosen at run time.
+//
 //--------------------------------------------------------------------
 
 #ifndef QUEUE_H
@@ -12,6 +17,7 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <vector>
 
 using namespace std;
 
@@ -25,6 +31,7 @@ class Queue {
     virtual ~Queue();
 
     virtual void enqueue(const DataType& newDataItem) throw (logic_error) = 0;
+    virtual void enqueue(DataType&& newDataItem) throw (logic_error) = 0;
     virtual DataType dequeue() throw (logic_error) = 0;
 
     virtual void clear() = 0;
@@ -47,6 +54,14 @@ class Queue {
 #endif
 
     virtual void showStructure() const = 0;
+
+    // Batch operations. The defaults simply repeat the single data item
+    // operations; implementations override them to pay for allocation,
+    // bounds checks and synchronization once per batch.
+    virtual void enqueueBatch(const DataType newDataItems[], int count)
+	throw (logic_error);
+    virtual int dequeueBatch(DataType dataItems[], int maxCount);
+    virtual int drain(vector<DataType>& dataItems);
 };
 
 template <typename DataType>
@@ -54,4 +69,35 @@ Queue<DataType>::~Queue()
 // Not worth having a separate class implementation file for the destuctor
 {}
 
+template <typename DataType>
+void Queue<DataType>::enqueueBatch(const DataType newDataItems[], int count)
+    throw (logic_error)
+// Inserts the count data items of newDataItems at the rear, in order.
+{
+    for (int i = 0; i < count; ++i)
+	enqueue(newDataItems[i]);
+}
+
+template <typename DataType>
+int Queue<DataType>::dequeueBatch(DataType dataItems[], int maxCount)
+// Removes up to maxCount data items from the front into dataItems and
+// returns how many were removed.
+{
+    int count = 0;
+    while (count < maxCount && !isEmpty())
+	dataItems[count++] = dequeue();
+    return count;
+}
+
+template <typename DataType>
+int Queue<DataType>::drain(vector<DataType>& dataItems)
+// Removes every data item, appending them to dataItems in queue order, and
+// returns how many were removed.
+{
+    int count = 0;
+    for (; !isEmpty(); ++count)
+	dataItems.push_back(dequeue());
+    return count;
+}
+
 #endif		// #ifndef QUEUE_H
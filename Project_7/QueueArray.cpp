@@ -0,0 +1,416 @@
+/** @file QueueArray.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement the array version of a Queue.
+* @details The specifications of this project match those of the book C++ Data
+* Structures - A Laboratory Course (3rd Edition) Project 7. The data items are
+* stored in a circular array: front marks the least recently added data item
+* and the rear wraps around to the beginning of the array once it reaches the
+* end. All operations, including putFront(), getRear() and getLength(), take
+* constant time and no memory is allocated per data item. By default the array
+* doubles in size when it is full. A fixed size Queue instead holds at most
+* maxNumber data items (Queue<DataType>::MAX_QUEUE_SIZE by default) and throws
+* when it is full.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "QueueArray.h"
+using namespace std;
+
+//
+// Queue Function Implementations //////////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty Queue with room for maxNumber data items.
+* @param maxNumber is the number of data items to allocate memory for.
+* @param fixedSize is true if the Queue may never hold more than maxNumber
+* data items, false if it grows when it is full.
+*/
+template<class DataType>
+QueueArray<DataType>::QueueArray(int maxNumber, bool fixedSize)
+{
+    maxSize = (maxNumber > 0) ? maxNumber : 1;
+    front = length = 0;
+    this->fixedSize = fixedSize;
+    dataItems = new DataType[maxSize];
+}
+
+/** The copy constructor
+* that initializes the Queue to be equivalent to the other Queue object
+* parameter.
+* @param other is the Queue to be equivalent to this Queue.
+* @see operator=(const QueueArray<DataType>& other)
+*/
+template<class DataType>
+QueueArray<DataType>::QueueArray(const QueueArray& other)
+{
+    maxSize = front = length = 0;
+    fixedSize = other.fixedSize;
+    dataItems = NULL;
+    *this = other;
+}
+
+/** The move constructor
+* that takes over the array of the other Queue.
+* @post The other Queue is an empty Queue without any memory.
+* @param other is the Queue whose data items are taken over.
+*/
+template<class DataType>
+QueueArray<DataType>::QueueArray(QueueArray&& other)
+{
+    maxSize = other.maxSize;
+    front = other.front;
+    length = other.length;
+    fixedSize = other.fixedSize;
+    dataItems = other.dataItems;
+    other.maxSize = other.front = other.length = 0;
+    other.dataItems = NULL;
+}
+
+/** The overloaded assignment operator
+* that sets the Queue to be equivalent to the other Queue object parameter and
+* returns a reference to the modified Queue. The data items are copied to the
+* start of the array.
+* @param other is the Queue that this Queue will be made equivalent to.
+* @return The reference to this object.
+*/
+template<class DataType>
+QueueArray<DataType>& QueueArray<DataType>::
+    operator=(const QueueArray<DataType>& other)
+{
+    if(this == &other)
+        return *this;
+
+    if(maxSize != other.maxSize)
+    {
+        delete[] dataItems;
+        maxSize = other.maxSize;
+        dataItems = new DataType[maxSize];
+    }
+    fixedSize = other.fixedSize;
+    front = 0;
+    length = other.length;
+    int index = other.front;
+    for(int i = 0; i < length; i++)
+    {
+        dataItems[i] = other.dataItems[index];
+        if(++index == other.maxSize)
+            index = 0;
+    }
+    return *this;
+}
+
+/** The move assignment operator
+* that releases the array of this Queue and takes over the array of the other
+* Queue.
+* @post The other Queue is an empty Queue without any memory.
+* @param other is the Queue whose data items are taken over.
+* @return The reference to this object.
+*/
+template<class DataType>
+QueueArray<DataType>& QueueArray<DataType>::
+    operator=(QueueArray<DataType>&& other)
+{
+    if(this == &other)
+        return *this;
+
+    delete[] dataItems;
+    maxSize = other.maxSize;
+    front = other.front;
+    length = other.length;
+    fixedSize = other.fixedSize;
+    dataItems = other.dataItems;
+    other.maxSize = other.front = other.length = 0;
+    other.dataItems = NULL;
+    return *this;
+}
+
+/** The destructor
+* that deallocates the memory used to store the Queue.
+*/
+template<class DataType>
+QueueArray<DataType>::~QueueArray()
+{
+    delete[] dataItems;
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue. A full Queue that is not fixed size grows first.
+* @pre Queue is not full.
+* @param newDataItem is the data to be added to the Queue.
+* @throw Queue is fixed size and full.
+*/
+template<class DataType>
+void QueueArray<DataType>::enqueue(const DataType& newDataItem)
+    throw (logic_error)
+{
+    if(length == maxSize)
+    {
+        if(fixedSize)
+            throw logic_error("enqueue() while queue is full");
+        grow(length + 1);
+    }
+    int back = front + length;
+    if(back >= maxSize)
+        back -= maxSize;
+    dataItems[back] = newDataItem;
+    length++;
+}
+
+/** Moves newDataItem
+* to the rear of the Queue. A full Queue that is not fixed size grows first.
+* @pre Queue is not full.
+* @param newDataItem is the data to be moved into the Queue.
+* @throw Queue is fixed size and full.
+*/
+template<class DataType>
+void QueueArray<DataType>::enqueue(DataType&& newDataItem)
+    throw (logic_error)
+{
+    if(length == maxSize)
+    {
+        if(fixedSize)
+            throw logic_error("enqueue() while queue is full");
+        grow(length + 1);
+    }
+    int back = front + length;
+    if(back >= maxSize)
+        back -= maxSize;
+    dataItems[back] = std::move(newDataItem);
+    length++;
+}
+
+/** Removes the data item
+* that was least recently added from the Queue and returns it.
+* @pre Queue is not empty.
+* @return DataType is the data removed from the Queue.
+* @throw Queue is empty.
+*/
+template<class DataType>
+DataType QueueArray<DataType>::dequeue() throw (logic_error)
+{
+    if(length == 0)
+        throw logic_error("dequeue() while queue is empty");
+
+    DataType tempData = std::move(dataItems[front]);
+    if(++front == maxSize)
+        front = 0;
+    length--;
+    return tempData;
+}
+
+/** Removes all data items in the Queue.
+* The memory of the array is kept for reuse.
+*/
+template<class DataType>
+void QueueArray<DataType>::clear()
+{
+    front = length = 0;
+}
+
+/** Returns true if the Queue is empty.
+* Otherwise, returns false.
+* @return The Queue is empty or not.
+*/
+template<class DataType>
+bool QueueArray<DataType>::isEmpty() const
+{
+    return (length == 0);
+}
+
+/** Returns true if the Queue is full.
+* Otherwise, returns false. A Queue that is not fixed size is never full.
+* @return The Queue is full or not.
+*/
+template<class DataType>
+bool QueueArray<DataType>::isFull() const
+{
+    return (fixedSize && length == maxSize);
+}
+
+/** Inserts newDataItem at the front
+* of the Queue. The order of preexisting data items is left unchanged.
+* @pre The Queue is not full.
+* @param newDataItem is the data item to be added to the Queue.
+* @throw Queue is fixed size and full.
+*/
+template<class DataType>
+void QueueArray<DataType>::putFront(const DataType& newDataItem)
+    throw (logic_error)
+{
+    if(length == maxSize)
+    {
+        if(fixedSize)
+            throw logic_error("putFront() while queue is full");
+        grow(length + 1);
+    }
+    if(--front < 0)
+        front = maxSize - 1;
+    dataItems[front] = newDataItem;
+    length++;
+}
+
+/** Removes the most recently added data item
+* from the Queue and returns it. The remainder of the Queue is left unchanged.
+* @pre The Queue is not empty.
+* @return DataType is the data removed from the Queue.
+* @throw Queue is empty.
+*/
+template<class DataType>
+DataType QueueArray<DataType>::getRear() throw (logic_error)
+{
+    if(length == 0)
+        throw logic_error("getRear() while queue is empty");
+
+    int back = front + length - 1;
+    if(back >= maxSize)
+        back -= maxSize;
+    length--;
+    return std::move(dataItems[back]);
+}
+
+/** Returns the number of data items
+* in the Queue.
+* @return int is the number of data items in a the Queue.
+*/
+template<class DataType>
+int QueueArray<DataType>::getLength() const
+{
+    return length;
+}
+
+/* Outputs the elements in a Queue.
+* If the Queue is empty, outputs "Empty queue". This operation is intended for
+* testing and debugging purposes only.
+*/
+template<class DataType>
+void QueueArray<DataType>::showStructure() const
+{
+    if ( isEmpty() )
+    cout << "Empty queue" << endl;
+    else
+    {
+    cout << "Front\t";
+    for ( int i = 0, p = front ; i < length ; i++ )
+    {
+        if( i == 0 )
+        {
+        cout << '[' << dataItems[p] << "] ";
+        }
+        else
+        {
+        cout << dataItems[p] << " ";
+        }
+        if ( ++p == maxSize )
+        p = 0;
+    }
+    cout << "\trear" << endl;
+    }
+}
+
+/** Inserts the count data items
+* of newDataItems at the rear of the Queue, in order. The Queue grows at most
+* once and the data items are copied in at most two runs.
+* @pre The Queue has room for count more data items.
+* @param newDataItems is the array of data to be added to the Queue.
+* @param count is the number of data items in newDataItems.
+* @throw Queue is fixed size and has no room for count more data items. No
+* data item is added.
+*/
+template<class DataType>
+void QueueArray<DataType>::enqueueBatch(const DataType newDataItems[],
+    int count) throw (logic_error)
+{
+    if(count <= 0)
+        return;
+    if(length + count > maxSize)
+    {
+        if(fixedSize)
+            throw logic_error("enqueueBatch() while queue is full");
+        grow(length + count);
+    }
+    int back = front + length;
+    if(back >= maxSize)
+        back -= maxSize;
+    //Copy up to the end of the array, then wrap around to the start
+    int firstRun = min(count, maxSize - back);
+    copy(newDataItems, newDataItems + firstRun, dataItems + back);
+    copy(newDataItems + firstRun, newDataItems + count, dataItems);
+    length += count;
+}
+
+/** Removes up to maxCount data items
+* from the front of the Queue into dataItems, in order.
+* @param dataItems is the array that receives the removed data.
+* @param maxCount is the number of data items dataItems can hold.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueArray<DataType>::dequeueBatch(DataType dataItems[], int maxCount)
+{
+    int count = min(maxCount, length);
+    if(count <= 0)
+        return 0;
+    //Move up to the end of the array, then wrap around to the start
+    int firstRun = min(count, maxSize - front);
+    std::move(this->dataItems + front, this->dataItems + front + firstRun,
+        dataItems);
+    std::move(this->dataItems, this->dataItems + count - firstRun,
+        dataItems + firstRun);
+    front += count;
+    if(front >= maxSize)
+        front -= maxSize;
+    length -= count;
+    return count;
+}
+
+/** Removes all data items
+* from the Queue, appending them to dataItems in Queue order.
+* @param dataItems is the vector that receives the removed data.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueArray<DataType>::drain(vector<DataType>& dataItems)
+{
+    int count = length;
+    int firstRun = min(count, maxSize - front);
+    dataItems.reserve(dataItems.size() + count);
+    dataItems.insert(dataItems.end(),
+        make_move_iterator(this->dataItems + front),
+        make_move_iterator(this->dataItems + front + firstRun));
+    dataItems.insert(dataItems.end(),
+        make_move_iterator(this->dataItems),
+        make_move_iterator(this->dataItems + count - firstRun));
+    clear();
+    return count;
+}
+
+/** Grows the array
+* by doubling its size until it can hold minSize data items. The data items are
+* moved to the start of the new array in Queue order. A moved-from Queue has no
+* array, so its first array holds one data item before doubling.
+* @param minSize is the number of data items the array must be able to hold.
+*/
+template<class DataType>
+void QueueArray<DataType>::grow(int minSize)
+{
+    int newSize = max(maxSize * 2, 1);
+    while(newSize < minSize)
+        newSize *= 2;
+    DataType* newItems = new DataType[newSize];
+    int index = front;
+    for(int i = 0; i < length; i++)
+    {
+        newItems[i] = std::move(dataItems[index]);
+        if(++index == maxSize)
+            index = 0;
+    }
+    delete[] dataItems;
+    dataItems = newItems;
+    maxSize = newSize;
+    front = 0;
+}
@@ -0,0 +1,56 @@
+// QueueArray.h
+
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+using namespace std;
+
+#include "Queue.h"
+
+template <typename DataType>
+class QueueArray final : public Queue<DataType> {
+  public:
+    QueueArray(int maxNumber = Queue<DataType>::MAX_QUEUE_SIZE,
+	bool fixedSize = false);
+    QueueArray(const QueueArray& other);
+    QueueArray(QueueArray&& other);
+    QueueArray& operator=(const QueueArray& other);
+    QueueArray& operator=(QueueArray&& other);
+    ~QueueArray();
+
+    void enqueue(const DataType& newDataItem) throw (logic_error);
+    void enqueue(DataType&& newDataItem) throw (logic_error);
+    DataType dequeue() throw (logic_error);
+
+    void clear();
+
+    bool isEmpty() const;
+    bool isFull() const;
+
+    // Programming Exercise 2
+    void putFront(const DataType& newDataItem) throw (logic_error);
+    DataType getRear() throw (logic_error);
+    // Programming Exercise 3
+    int getLength() const;
+
+    void showStructure() const;
+
+    // Batch operations
+    void enqueueBatch(const DataType newDataItems[], int count)
+	throw (logic_error);
+    int dequeueBatch(DataType dataItems[], int maxCount);
+    int drain(vector<DataType>& dataItems);
+
+  private:
+    void grow(int minSize);
+
+    int maxSize;        // Number of data items the array can hold
+    int front;          // Index of the front data item
+    int length;         // Number of data items in the Queue
+    bool fixedSize;     // Throw when full instead of growing
+    DataType* dataItems;
+};
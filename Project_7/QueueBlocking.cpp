@@ -0,0 +1,551 @@
+/** @file QueueBlocking.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement a thread safe, bounded version of a Queue
+* whose operations wait for room or for data items.
+* @details The data items are stored in a circular array of fixed size, as in
+* QueueArray, guarded by one mutex. A producer that finds the Queue full waits
+* on notFull and a consumer that finds it empty waits on notEmpty, so a fast
+* producer is held back instead of using up memory. Every thread that waits is
+* counted, and an operation only signals a condition variable when some thread
+* is waiting on it. It then wakes one waiting thread per data item or free cell
+* it made available instead of all of them, and it does so after releasing the
+* mutex, so the woken thread does not immediately block on it again.
+* \n enqueue() and dequeue() wait as long as necessary, tryEnqueue() and
+* tryDequeue() never wait, and tryEnqueueFor() and tryDequeueFor() wait at most
+* the given time. close() shuts the Queue down: every waiting thread is woken,
+* no more data items are accepted, and the data items already in the Queue can
+* still be dequeued. Once a closed Queue is empty, dequeue() throws and the
+* other removing operations report that nothing was removed.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "QueueBlocking.h"
+using namespace std;
+
+//
+// Queue Function Implementations //////////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty, open Queue that holds at most maxNumber data items.
+* @param maxNumber is the number of data items the Queue can hold.
+*/
+template<class DataType>
+QueueBlocking<DataType>::QueueBlocking(int maxNumber)
+{
+    maxSize = (maxNumber > 0) ? maxNumber : 1;
+    front = length = 0;
+    dataItems = new DataType[maxSize];
+    waitingProducers = waitingConsumers = 0;
+    closed = false;
+}
+
+/** The destructor
+* that deallocates the memory used to store the Queue.
+* @pre No other thread is using the Queue.
+*/
+template<class DataType>
+QueueBlocking<DataType>::~QueueBlocking()
+{
+    delete[] dataItems;
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue, waiting for room if the Queue is full.
+* @param newDataItem is the data to be added to the Queue.
+* @throw Queue is closed.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::enqueue(const DataType& newDataItem)
+    throw (logic_error)
+{
+    push(newDataItem, true, chrono::nanoseconds::max());
+}
+
+/** Moves newDataItem
+* to the rear of the Queue, waiting for room if the Queue is full.
+* @param newDataItem is the data to be moved into the Queue.
+* @throw Queue is closed.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::enqueue(DataType&& newDataItem)
+    throw (logic_error)
+{
+    push(std::move(newDataItem), true, chrono::nanoseconds::max());
+}
+
+/** Removes the data item
+* that was least recently added from the Queue and returns it, waiting for one
+* if the Queue is empty.
+* @return DataType is the data removed from the Queue.
+* @throw Queue is closed and empty.
+*/
+template<class DataType>
+DataType QueueBlocking<DataType>::dequeue() throw (logic_error)
+{
+    DataType dataItem;
+    if(!pop(dataItem, true, chrono::nanoseconds::max()))
+        throw logic_error("dequeue() while queue is closed and empty");
+    return dataItem;
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue if there is room for it. Never waits.
+* @param newDataItem is the data to be added to the Queue.
+* @return True if newDataItem was added. False if the Queue was full.
+* @throw Queue is closed.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::tryEnqueue(const DataType& newDataItem)
+{
+    return push(newDataItem, false, chrono::nanoseconds::zero());
+}
+
+/** Moves newDataItem
+* to the rear of the Queue if there is room for it. Never waits.
+* @param newDataItem is the data to be moved into the Queue.
+* @return True if newDataItem was added. False if the Queue was full.
+* @throw Queue is closed.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::tryEnqueue(DataType&& newDataItem)
+{
+    return push(std::move(newDataItem), false, chrono::nanoseconds::zero());
+}
+
+/** Removes the least recently added data item
+* into dataItem if the Queue is not empty. Never waits.
+* @param dataItem is set to the data removed from the Queue.
+* @return True if a data item was removed. False if the Queue was empty.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::tryDequeue(DataType& dataItem)
+{
+    return pop(dataItem, false, chrono::nanoseconds::zero());
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue, waiting at most timeout for room.
+* @param newDataItem is the data to be added to the Queue.
+* @param timeout is the longest time to wait.
+* @return True if newDataItem was added. False if the Queue stayed full.
+* @throw Queue is closed.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::tryEnqueueFor(const DataType& newDataItem,
+    chrono::nanoseconds timeout)
+{
+    return push(newDataItem, true, timeout);
+}
+
+/** Removes the least recently added data item
+* into dataItem, waiting at most timeout for one.
+* @param dataItem is set to the data removed from the Queue.
+* @param timeout is the longest time to wait.
+* @return True if a data item was removed. False if the Queue stayed empty or
+* is closed and empty.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::tryDequeueFor(DataType& dataItem,
+    chrono::nanoseconds timeout)
+{
+    return pop(dataItem, true, timeout);
+}
+
+/** Closes the Queue.
+* Wakes every waiting thread. Data items can no longer be added, but the ones in
+* the Queue can still be removed.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::close()
+{
+    {
+        lock_guard<mutex> lock(queueLock);
+        closed = true;
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+}
+
+/** Returns true if the Queue has been closed.
+* Otherwise, returns false.
+* @return The Queue is closed or not.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::isClosed() const
+{
+    lock_guard<mutex> lock(queueLock);
+    return closed;
+}
+
+/** Removes all data items in the Queue.
+* Wakes the producers waiting for room.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::clear()
+{
+    unique_lock<mutex> lock(queueLock);
+    int count = length;
+    front = length = 0;
+    int numWaiting = waitingProducers;
+    lock.unlock();
+    wake(notFull, numWaiting, count);
+}
+
+/** Returns true if the Queue is empty.
+* Otherwise, returns false. Only a snapshot while other threads are running.
+* @return The Queue is empty or not.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::isEmpty() const
+{
+    lock_guard<mutex> lock(queueLock);
+    return (length == 0);
+}
+
+/** Returns true if the Queue is full.
+* Otherwise, returns false. Only a snapshot while other threads are running.
+* @return The Queue is full or not.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::isFull() const
+{
+    lock_guard<mutex> lock(queueLock);
+    return (length == maxSize);
+}
+
+/** Inserts newDataItem at the front
+* of the Queue, waiting for room if the Queue is full. The order of preexisting
+* data items is left unchanged.
+* @param newDataItem is the data item to be added to the Queue.
+* @throw Queue is closed.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::putFront(const DataType& newDataItem)
+    throw (logic_error)
+{
+    unique_lock<mutex> lock(queueLock);
+    waitUntil(notFull, lock, waitingProducers, true,
+        chrono::nanoseconds::max(), &QueueBlocking::canEnqueue);
+    if(closed)
+        throw logic_error("putFront() while queue is closed");
+
+    if(--front < 0)
+        front = maxSize - 1;
+    dataItems[front] = newDataItem;
+    length++;
+    int numWaiting = waitingConsumers;
+    lock.unlock();
+    wake(notEmpty, numWaiting, 1);
+}
+
+/** Removes the most recently added data item
+* from the Queue and returns it, waiting for one if the Queue is empty.
+* @return DataType is the data removed from the Queue.
+* @throw Queue is closed and empty.
+*/
+template<class DataType>
+DataType QueueBlocking<DataType>::getRear() throw (logic_error)
+{
+    unique_lock<mutex> lock(queueLock);
+    waitUntil(notEmpty, lock, waitingConsumers, true,
+        chrono::nanoseconds::max(), &QueueBlocking::canDequeue);
+    if(length == 0)
+        throw logic_error("getRear() while queue is closed and empty");
+
+    int back = front + length - 1;
+    if(back >= maxSize)
+        back -= maxSize;
+    DataType tempData = std::move(dataItems[back]);
+    length--;
+    int numWaiting = waitingProducers;
+    lock.unlock();
+    wake(notFull, numWaiting, 1);
+    return tempData;
+}
+
+/** Returns the number of data items
+* in the Queue. Only a snapshot while other threads are running.
+* @return int is the number of data items in a the Queue.
+*/
+template<class DataType>
+int QueueBlocking<DataType>::getLength() const
+{
+    lock_guard<mutex> lock(queueLock);
+    return length;
+}
+
+/* Outputs the elements in a Queue.
+* If the Queue is empty, outputs "Empty queue". This operation is intended for
+* testing and debugging purposes only.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::showStructure() const
+{
+    lock_guard<mutex> lock(queueLock);
+
+    if ( length == 0 )
+    cout << "Empty queue" << endl;
+    else
+    {
+    cout << "Front\t";
+    for ( int i = 0, p = front ; i < length ; i++ )
+    {
+        if( i == 0 )
+        {
+        cout << '[' << dataItems[p] << "] ";
+        }
+        else
+        {
+        cout << dataItems[p] << " ";
+        }
+        if ( ++p == maxSize )
+        p = 0;
+    }
+    cout << "\trear" << endl;
+    }
+    if ( closed )
+    cout << "(closed)" << endl;
+}
+
+/** Inserts the count data items
+* of newDataItems at the rear of the Queue, in order. Adds as many as fit each
+* time room is made, waiting for room as often as necessary.
+* @param newDataItems is the array of data to be added to the Queue.
+* @param count is the number of data items in newDataItems.
+* @throw Queue is closed. The data items added before it was closed stay in
+* the Queue.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::enqueueBatch(const DataType newDataItems[],
+    int count) throw (logic_error)
+{
+    unique_lock<mutex> lock(queueLock);
+    int done = 0;
+    while(done < count)
+    {
+        waitUntil(notFull, lock, waitingProducers, true,
+            chrono::nanoseconds::max(), &QueueBlocking::canEnqueue);
+        if(closed)
+            throw logic_error("enqueueBatch() while queue is closed");
+
+        int runLength = min(count - done, maxSize - length);
+        int back = front + length;
+        for(int i = 0; i < runLength; i++)
+        {
+            if(back >= maxSize)
+                back -= maxSize;
+            dataItems[back++] = newDataItems[done++];
+        }
+        length += runLength;
+
+        int numWaiting = waitingConsumers;
+        lock.unlock();
+        wake(notEmpty, numWaiting, runLength);
+        lock.lock();
+    }
+}
+
+/** Removes up to maxCount data items
+* from the front of the Queue into dataItems, in order, waiting until there is
+* at least one.
+* @param dataItems is the array that receives the removed data.
+* @param maxCount is the number of data items dataItems can hold.
+* @return int is the number of data items removed. Zero only if the Queue is
+* closed and empty.
+*/
+template<class DataType>
+int QueueBlocking<DataType>::dequeueBatch(DataType dataItems[], int maxCount)
+{
+    if(maxCount <= 0)
+        return 0;
+
+    unique_lock<mutex> lock(queueLock);
+    waitUntil(notEmpty, lock, waitingConsumers, true,
+        chrono::nanoseconds::max(), &QueueBlocking::canDequeue);
+
+    int count = min(maxCount, length);
+    for(int i = 0; i < count; i++)
+    {
+        dataItems[i] = std::move(this->dataItems[front]);
+        if(++front == maxSize)
+            front = 0;
+    }
+    length -= count;
+
+    int numWaiting = waitingProducers;
+    lock.unlock();
+    wake(notFull, numWaiting, count);
+    return count;
+}
+
+/** Removes all data items
+* that are in the Queue, appending them to dataItems in Queue order. Never
+* waits.
+* @param dataItems is the vector that receives the removed data.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueBlocking<DataType>::drain(vector<DataType>& dataItems)
+{
+    unique_lock<mutex> lock(queueLock);
+    int count = length;
+    dataItems.reserve(dataItems.size() + count);
+    for(int i = 0; i < count; i++)
+    {
+        dataItems.push_back(std::move(this->dataItems[front]));
+        if(++front == maxSize)
+            front = 0;
+    }
+    length = 0;
+
+    int numWaiting = waitingProducers;
+    lock.unlock();
+    wake(notFull, numWaiting, count);
+    return count;
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue once there is room for it.
+* @param newDataItem is the data to be copied or moved into the Queue.
+* @param wait is false if the Queue must not wait for room.
+* @param timeout is the longest time to wait. chrono::nanoseconds::max() waits
+* as long as necessary.
+* @return True if newDataItem was added. False if the Queue stayed full.
+* @throw Queue is closed.
+*/
+template<class DataType>
+template<typename ItemType>
+bool QueueBlocking<DataType>::push(ItemType&& newDataItem, bool wait,
+    chrono::nanoseconds timeout) throw (logic_error)
+{
+    unique_lock<mutex> lock(queueLock);
+    if(!waitUntil(notFull, lock, waitingProducers, wait, timeout,
+        &QueueBlocking::canEnqueue))
+        return false;
+    if(closed)
+        throw logic_error("enqueue() while queue is closed");
+
+    int back = front + length;
+    if(back >= maxSize)
+        back -= maxSize;
+    dataItems[back] = std::forward<ItemType>(newDataItem);
+    length++;
+
+    int numWaiting = waitingConsumers;
+    lock.unlock();
+    wake(notEmpty, numWaiting, 1);
+    return true;
+}
+
+/** Removes the least recently added data item
+* into dataItem once there is one.
+* @param dataItem is set to the data removed from the Queue.
+* @param wait is false if the Queue must not wait for a data item.
+* @param timeout is the longest time to wait. chrono::nanoseconds::max() waits
+* as long as necessary.
+* @return True if a data item was removed. False if the Queue stayed empty or
+* is closed and empty.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::pop(DataType& dataItem, bool wait,
+    chrono::nanoseconds timeout) throw (logic_error)
+{
+    unique_lock<mutex> lock(queueLock);
+    if(!waitUntil(notEmpty, lock, waitingConsumers, wait, timeout,
+        &QueueBlocking::canDequeue) || length == 0)
+        return false;
+
+    dataItem = std::move(dataItems[front]);
+    if(++front == maxSize)
+        front = 0;
+    length--;
+
+    int numWaiting = waitingProducers;
+    lock.unlock();
+    wake(notFull, numWaiting, 1);
+    return true;
+}
+
+/** Waits on condition
+* until ready() is true, counting the calling thread in numWaiting while it
+* waits.
+* @pre lock holds queueLock.
+* @param condition is the condition variable signalled when ready() may have
+* become true.
+* @param lock is the lock on queueLock.
+* @param numWaiting is the count of the threads waiting on condition.
+* @param wait is false if the caller must not wait.
+* @param timeout is the longest time to wait. chrono::nanoseconds::max() waits
+* as long as necessary.
+* @param ready is canEnqueue or canDequeue.
+* @return True if ready() is true. False if the wait timed out.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::waitUntil(condition_variable& condition,
+    unique_lock<mutex>& lock, int& numWaiting, bool wait,
+    chrono::nanoseconds timeout, bool (QueueBlocking::*ready)() const)
+{
+    if((this->*ready)())
+        return true;
+    if(!wait)
+        return false;
+
+    bool isReady = true;
+    auto predicate = [this, ready]() { return (this->*ready)(); };
+    numWaiting++;
+    if(timeout == chrono::nanoseconds::max())
+        condition.wait(lock, predicate);
+    else
+        isReady = condition.wait_for(lock, timeout, predicate);
+    numWaiting--;
+    return isReady;
+}
+
+/** Returns true if a producer may go on:
+* there is room in the Queue, or the Queue is closed and the producer must fail.
+* @pre The calling thread holds queueLock.
+* @return A producer may go on or not.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::canEnqueue() const
+{
+    return (closed || length < maxSize);
+}
+
+/** Returns true if a consumer may go on:
+* there is a data item in the Queue, or the Queue is closed and no data item
+* will ever arrive.
+* @pre The calling thread holds queueLock.
+* @return A consumer may go on or not.
+*/
+template<class DataType>
+bool QueueBlocking<DataType>::canDequeue() const
+{
+    return (closed || length > 0);
+}
+
+/** Wakes the threads
+* waiting on condition that can use count newly available data items or free
+* cells: one thread per data item or cell, and none if no thread is waiting.
+* @pre The calling thread does not hold queueLock.
+* @param condition is the condition variable to signal.
+* @param numWaiting is the number of threads that were waiting on condition.
+* @param count is the number of data items or cells made available.
+*/
+template<class DataType>
+void QueueBlocking<DataType>::wake(condition_variable& condition,
+    int numWaiting, int count)
+{
+    if(numWaiting == 0 || count <= 0)
+        return;
+    if(count >= numWaiting)
+        condition.notify_all();
+    else
+        for(int i = 0; i < count; i++)
+            condition.notify_one();
+}
@@ -0,0 +1,88 @@
+// QueueBlocking.h
+
+#include <stdexcept>
+#include <iostream>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+#include "Queue.h"
+
+template <typename DataType>
+class QueueBlocking final : public Queue<DataType> {
+  public:
+    QueueBlocking(int maxNumber = Queue<DataType>::MAX_QUEUE_SIZE);
+    ~QueueBlocking();
+
+    // Block while the Queue is full (enqueue) or empty (dequeue)
+    void enqueue(const DataType& newDataItem) throw (logic_error);
+    void enqueue(DataType&& newDataItem) throw (logic_error);
+    DataType dequeue() throw (logic_error);
+
+    // Non-blocking versions
+    bool tryEnqueue(const DataType& newDataItem);
+    bool tryEnqueue(DataType&& newDataItem);
+    bool tryDequeue(DataType& dataItem);
+
+    // Versions that give up after timeout
+    bool tryEnqueueFor(const DataType& newDataItem,
+		       chrono::nanoseconds timeout);
+    bool tryDequeueFor(DataType& dataItem, chrono::nanoseconds timeout);
+
+    // Shutdown: no more data items are accepted, the rest can be dequeued
+    void close();
+    bool isClosed() const;
+
+    void clear();
+
+    bool isEmpty() const;
+    bool isFull() const;
+
+    // Programming Exercise 2
+    void putFront(const DataType& newDataItem) throw (logic_error);
+    DataType getRear() throw (logic_error);
+    // Programming Exercise 3
+    int getLength() const;
+
+    void showStructure() const;
+
+    // Batch operations, each taking the lock once per run of data items
+    void enqueueBatch(const DataType newDataItems[], int count)
+	throw (logic_error);
+    int dequeueBatch(DataType dataItems[], int maxCount);
+    int drain(vector<DataType>& dataItems);
+
+  private:
+    // Shared between threads, so copying is not supported
+    QueueBlocking(const QueueBlocking& other);
+    QueueBlocking& operator=(const QueueBlocking& other);
+
+    template <typename ItemType>
+    bool push(ItemType&& newDataItem, bool wait,
+	      chrono::nanoseconds timeout) throw (logic_error);
+    bool pop(DataType& dataItem, bool wait, chrono::nanoseconds timeout)
+	throw (logic_error);
+    bool waitUntil(condition_variable& condition, unique_lock<mutex>& lock,
+		   int& numWaiting, bool wait, chrono::nanoseconds timeout,
+		   bool (QueueBlocking::*ready)() const);
+    bool canEnqueue() const;
+    bool canDequeue() const;
+    void wake(condition_variable& condition, int numWaiting, int count);
+
+    // Circular array, as in QueueArray
+    int maxSize;                        // Number of data items it can hold
+    int front;                          // Index of the front data item
+    int length;                         // Number of data items in the Queue
+    DataType* dataItems;
+
+    mutable mutex queueLock;
+    condition_variable notEmpty;        // Signalled when data items arrive
+    condition_variable notFull;         // Signalled when room is made
+    int waitingProducers;               // Threads waiting on notFull
+    int waitingConsumers;               // Threads waiting on notEmpty
+    bool closed;
+};
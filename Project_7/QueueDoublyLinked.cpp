@@ -0,0 +1,395 @@
+/** @file QueueDoublyLinked.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement the doubly linked list version of a Queue.
+* @details The specifications of this project match those of the book C++ Data
+* Structures - A Laboratory Course (3rd Edition) Project 7. Every node is linked
+* to the node before it as well as the node after it, and the number of data
+* items is kept up to date. Unlike QueueLinked, getRear() does not have to walk
+* the Queue to find the new rear and getLength() does not have to count the
+* nodes, so all four end operations and getLength() take constant time and the
+* Queue can be used as a deque.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "QueueDoublyLinked.h"
+using namespace std;
+
+//
+// Queue Function Implementations //////////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty Queue.
+* @param maxNumber is provided for call compatibility with the array
+* implementation.
+*/
+template<class DataType>
+QueueDoublyLinked<DataType>::QueueDoublyLinked(int /*maxNumber*/)
+{
+    front = back = NULL;
+    length = 0;
+}
+
+/** The copy constructor
+* that initializes the Queue to be equivalent to the other Queue object
+* parameter.
+* @param other is the Queue to be equivalent to this Queue.
+* @see operator=(const QueueDoublyLinked<DataType>& other)
+*/
+template<class DataType>
+QueueDoublyLinked<DataType>::QueueDoublyLinked(const QueueDoublyLinked& other)
+{
+    front = back = NULL;
+    length = 0;
+    *this = other;
+}
+
+/** The move constructor
+* that takes over the nodes of the other Queue. The other Queue is left empty.
+* @param other is the Queue whose nodes are taken over.
+*/
+template<class DataType>
+QueueDoublyLinked<DataType>::QueueDoublyLinked(QueueDoublyLinked&& other)
+{
+    front = other.front;
+    back = other.back;
+    length = other.length;
+    other.front = other.back = NULL;
+    other.length = 0;
+}
+
+/** The overloaded assignment operator
+* that sets the Queue to be equivalent to the other Queue object parameter and
+* returns a reference to the modified Queue.
+* @param other is the Queue that this Queue will be made equivalent to.
+* @return The reference to this object.
+*/
+template<class DataType>
+QueueDoublyLinked<DataType>& QueueDoublyLinked<DataType>::
+    operator=(const QueueDoublyLinked<DataType>& other)
+{
+    if(this == &other)
+        return *this;
+
+    clear();
+    for(QueueNode* temp = other.front; temp != NULL; temp = temp->next)
+        emplace(temp->dataItem);
+    return *this;
+}
+
+/** The move assignment operator
+* that releases the nodes of this Queue and takes over the nodes of the other
+* Queue. The other Queue is left empty.
+* @param other is the Queue whose nodes are taken over.
+* @return The reference to this object.
+*/
+template<class DataType>
+QueueDoublyLinked<DataType>& QueueDoublyLinked<DataType>::
+    operator=(QueueDoublyLinked<DataType>&& other)
+{
+    if(this == &other)
+        return *this;
+
+    clear();
+    front = other.front;
+    back = other.back;
+    length = other.length;
+    other.front = other.back = NULL;
+    other.length = 0;
+    return *this;
+}
+
+/** The destructor
+* that deallocates the memory used to store the Queue.
+* @see clear()
+*/
+template<class DataType>
+QueueDoublyLinked<DataType>::~QueueDoublyLinked()
+{
+    clear();
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue.
+* @pre Queue is not full.
+* @param newDataItem is the data to be added to the Queue.
+* @see emplace()
+*/
+template<class DataType>
+void QueueDoublyLinked<DataType>::enqueue(const DataType& newDataItem)
+    throw (logic_error)
+{
+    emplace(newDataItem);
+}
+
+/** Moves newDataItem
+* to the rear of the Queue.
+* @pre Queue is not full.
+* @param newDataItem is the data to be moved into the Queue.
+* @see emplace()
+*/
+template<class DataType>
+void QueueDoublyLinked<DataType>::enqueue(DataType&& newDataItem)
+    throw (logic_error)
+{
+    emplace(std::move(newDataItem));
+}
+
+/** Constructs a new data item in place from args
+* at the rear of the Queue. No temporary data item is created.
+* @pre Queue is not full.
+* @param args are the constructor arguments for the new data item.
+*/
+template<class DataType>
+template<typename... Args>
+void QueueDoublyLinked<DataType>::emplace(Args&&... args) throw (logic_error)
+{
+    QueueNode* temp = new QueueNode(back, NULL, std::forward<Args>(args)...);
+    if(back != NULL)
+        back->next = temp;
+    else
+        front = temp;
+    back = temp;
+    length++;
+}
+
+/** Removes the data item
+* that was least recently added from the Queue and returns it.
+* @pre Queue is not empty.
+* @return DataType is the data removed from the Queue.
+* @throw Queue is empty.
+*/
+template<class DataType>
+DataType QueueDoublyLinked<DataType>::dequeue() throw (logic_error)
+{
+    if(isEmpty())
+        throw logic_error("dequeue() while queue is empty");
+
+    QueueNode* temp = front;
+    DataType tempData = std::move(temp->dataItem);
+    front = temp->next;
+    if(front != NULL)
+        front->prior = NULL;
+    else
+        back = NULL;
+    delete temp;
+    length--;
+    return tempData;
+}
+
+/** Removes all data items in the Queue.
+* It will deallocate memory used for the nodes to store the data.
+*/
+template<class DataType>
+void QueueDoublyLinked<DataType>::clear()
+{
+    while(front != NULL)
+    {
+        QueueNode* temp = front->next;
+        delete front;
+        front = temp;
+    }
+    back = NULL;
+    length = 0;
+}
+
+/** Returns true if the Queue is empty.
+* Otherwise, returns false.
+* @return The Queue is empty or not.
+*/
+template<class DataType>
+bool QueueDoublyLinked<DataType>::isEmpty() const
+{
+    return (front == NULL);
+}
+
+/** Returns true if the Queue is full.
+* Otherwise, returns false. A linked Queue is never full.
+* @return The Queue is full or not.
+*/
+template<class DataType>
+bool QueueDoublyLinked<DataType>::isFull() const
+{
+    return false;
+}
+
+/** Inserts newDataItem at the front
+* of the Queue. The order of preexisting data items is left unchanged.
+* @pre The Queue is not full.
+* @param newDataItem is the data item to be added to the Queue.
+*/
+template<class DataType>
+void QueueDoublyLinked<DataType>::putFront(const DataType& newDataItem)
+    throw (logic_error)
+{
+    QueueNode* temp = new QueueNode(NULL, front, newDataItem);
+    if(front != NULL)
+        front->prior = temp;
+    else
+        back = temp;
+    front = temp;
+    length++;
+}
+
+/** Removes the most recently added data item
+* from the Queue and returns it. The remainder of the Queue is left unchanged.
+* @pre The Queue is not empty.
+* @return DataType is the data removed from the Queue.
+* @throw Queue is empty.
+*/
+template<class DataType>
+DataType QueueDoublyLinked<DataType>::getRear() throw (logic_error)
+{
+    if(isEmpty())
+        throw logic_error("getRear() while queue is empty");
+
+    QueueNode* temp = back;
+    DataType tempData = std::move(temp->dataItem);
+    back = temp->prior;
+    if(back != NULL)
+        back->next = NULL;
+    else
+        front = NULL;
+    delete temp;
+    length--;
+    return tempData;
+}
+
+/** Returns the number of data items
+* in the Queue.
+* @return int is the number of data items in a the Queue.
+*/
+template<class DataType>
+int QueueDoublyLinked<DataType>::getLength() const
+{
+    return length;
+}
+
+/* Outputs the elements in a Queue.
+* If the Queue is empty, outputs "Empty queue". This operation is intended for
+* testing and debugging purposes only.
+*/
+template<class DataType>
+void QueueDoublyLinked<DataType>::showStructure() const
+{
+    // Iterates through the queue
+    QueueNode* p;
+
+    if ( isEmpty() )
+    cout << "Empty queue" << endl;
+    else
+    {
+    cout << "Front\t";
+    for ( p = front ; p != NULL ; p = p->next )
+    {
+        if( p == front )
+        {
+        cout << '[' << p->dataItem << "] ";
+        }
+        else
+        {
+        cout << p->dataItem << " ";
+        }
+    }
+    cout << "\trear" << endl;
+    }
+}
+
+/** Inserts the count data items
+* of newDataItems at the rear of the Queue, in order. The new nodes are linked
+* to each other first and then to the Queue in one step.
+* @pre Queue is not full.
+* @param newDataItems is the array of data to be added to the Queue.
+* @param count is the number of data items in newDataItems.
+*/
+template<class DataType>
+void QueueDoublyLinked<DataType>::enqueueBatch(const DataType newDataItems[],
+    int count) throw (logic_error)
+{
+    if(count <= 0)
+        return;
+
+    QueueNode* first = new QueueNode(NULL, NULL, newDataItems[0]);
+    QueueNode* last = first;
+    for(int i = 1; i < count; i++)
+        last = last->next = new QueueNode(last, NULL, newDataItems[i]);
+    if(back != NULL)
+    {
+        back->next = first;
+        first->prior = back;
+    }
+    else
+        front = first;
+    back = last;
+    length += count;
+}
+
+/** Removes up to maxCount data items
+* from the front of the Queue into dataItems, in order.
+* @param dataItems is the array that receives the removed data.
+* @param maxCount is the number of data items dataItems can hold.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueDoublyLinked<DataType>::dequeueBatch(DataType dataItems[], int maxCount)
+{
+    int count = 0;
+    while(count < maxCount && front != NULL)
+    {
+        QueueNode* temp = front;
+        dataItems[count++] = std::move(temp->dataItem);
+        front = temp->next;
+        delete temp;
+    }
+    if(front != NULL)
+        front->prior = NULL;
+    else
+        back = NULL;
+    length -= count;
+    return count;
+}
+
+/** Removes all data items
+* from the Queue, appending them to dataItems in Queue order.
+* @param dataItems is the vector that receives the removed data.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueDoublyLinked<DataType>::drain(vector<DataType>& dataItems)
+{
+    int count = 0;
+    while(front != NULL)
+    {
+        QueueNode* temp = front;
+        dataItems.push_back(std::move(temp->dataItem));
+        front = temp->next;
+        delete temp;
+        count++;
+    }
+    back = NULL;
+    length = 0;
+    return count;
+}
+
+//
+// QueueNode Function Implementations //////////////////////////////////////////
+//
+
+/** The emplacing constructor
+* that constructs the QueueNode's data item in place from args and links the
+* QueueNode between priorPtr and nextPtr.
+* @param priorPtr is the pointer to the node before this node.
+* @param nextPtr is the pointer to the node after this node.
+* @param args are the constructor arguments for the data item.
+*/
+template<class DataType>
+template<typename... Args>
+QueueDoublyLinked<DataType>::QueueNode::QueueNode(QueueNode* priorPtr,
+    QueueNode* nextPtr, Args&&... args)
+    : dataItem(std::forward<Args>(args)...), prior(priorPtr), next(nextPtr)
+{
+}
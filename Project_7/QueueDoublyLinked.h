@@ -0,0 +1,61 @@
+// QueueDoublyLinked.h
+
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#include "Queue.h"
+
+template <typename DataType>
+class QueueDoublyLinked final : public Queue<DataType> {
+  public:
+    QueueDoublyLinked(int maxNumber = Queue<DataType>::MAX_QUEUE_SIZE);
+    QueueDoublyLinked(const QueueDoublyLinked& other);
+    QueueDoublyLinked(QueueDoublyLinked&& other);
+    QueueDoublyLinked& operator=(const QueueDoublyLinked& other);
+    QueueDoublyLinked& operator=(QueueDoublyLinked&& other);
+    ~QueueDoublyLinked();
+
+    void enqueue(const DataType& newDataItem) throw (logic_error);
+    void enqueue(DataType&& newDataItem) throw (logic_error);
+    template <typename... Args>
+    void emplace(Args&&... args) throw (logic_error);
+    DataType dequeue() throw (logic_error);
+
+    void clear();
+
+    bool isEmpty() const;
+    bool isFull() const;
+
+    // Programming Exercise 2
+    void putFront(const DataType& newDataItem) throw (logic_error);
+    DataType getRear() throw (logic_error);
+    // Programming Exercise 3
+    int getLength() const;
+
+    void showStructure() const;
+
+    // Batch operations
+    void enqueueBatch(const DataType newDataItems[], int count)
+	throw (logic_error);
+    int dequeueBatch(DataType dataItems[], int maxCount);
+    int drain(vector<DataType>& dataItems);
+
+  private:
+    class QueueNode {
+      public:
+	template <typename... Args>
+	QueueNode(QueueNode* priorPtr, QueueNode* nextPtr, Args&&... args);
+
+	DataType dataItem;
+	QueueNode* prior;
+	QueueNode* next;
+    };
+
+    QueueNode* front;
+    QueueNode* back;
+    int length;         // Number of data items in the Queue
+};
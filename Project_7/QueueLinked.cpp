@@ -44,7 +44,19 @@ template<class DataType>
 QueueLinked<DataType>::QueueLinked(const QueueLinked& other)
 {
     front = back = NULL;
-    this = other;
+    *this = other;
+}
+
+/** The move constructor
+* that takes over the nodes of the other Queue. The other Queue is left empty.
+* @param other is the Queue whose nodes are taken over.
+*/
+template<class DataType>
+QueueLinked<DataType>::QueueLinked(QueueLinked&& other)
+{
+    front = other.front;
+    back = other.back;
+    other.front = other.back = NULL;
 }
 
 /** The overloaded assignment operator
@@ -57,16 +69,39 @@ template<class DataType>
 QueueLinked<DataType>& QueueLinked<DataType>::
     operator=(const QueueLinked<DataType>& other)
 {
+    if(this == &other)
+        return *this;
+
     clear();
     QueueNode* temp = other.front;
     while(temp != NULL)
     {
-        insert(temp->dataItem);
+        enqueue(temp->dataItem);
         temp = temp->next;
     }
     return *this;
 }
 
+/** The move assignment operator
+* that releases the nodes of this Queue and takes over the nodes of the other
+* Queue. The other Queue is left empty.
+* @param other is the Queue whose nodes are taken over.
+* @return The reference to this object.
+*/
+template<class DataType>
+QueueLinked<DataType>& QueueLinked<DataType>::
+    operator=(QueueLinked<DataType>&& other)
+{
+    if(this == &other)
+        return *this;
+
+    clear();
+    front = other.front;
+    back = other.back;
+    other.front = other.back = NULL;
+    return *this;
+}
+
 /** The destructor
 * that deallocates the memory used to store the Queue.
 * @see clear()
@@ -81,16 +116,43 @@ QueueLinked<DataType>::~QueueLinked()
 * at the rear of the Queue.
 * @pre Queue is not full.
 * @param newDataItem is the data to be added to the Queue.
+* @see emplace()
 */
 template<class DataType>
 void QueueLinked<DataType>::enqueue(const DataType& newDataItem)
     throw (logic_error)
+{
+    emplace(newDataItem);
+}
+
+/** Moves newDataItem
+* to the rear of the Queue.
+* @pre Queue is not full.
+* @param newDataItem is the data to be moved into the Queue.
+* @see emplace()
+*/
+template<class DataType>
+void QueueLinked<DataType>::enqueue(DataType&& newDataItem)
+    throw (logic_error)
+{
+    emplace(std::move(newDataItem));
+}
+
+/** Constructs a new data item in place from args
+* at the rear of the Queue. No temporary data item is created.
+* @pre Queue is not full.
+* @param args are the constructor arguments for the new data item.
+*/
+template<class DataType>
+template<typename... Args>
+void QueueLinked<DataType>::emplace(Args&&... args) throw (logic_error)
 {
     if(!isFull())
         if(!isEmpty())
-            back = back->next = new QueueNode(newDataItem, NULL);
+            back = back->next = new QueueNode(NULL,
+                std::forward<Args>(args)...);
         else
-            front = back = new QueueNode(newDataItem, NULL);
+            front = back = new QueueNode(NULL, std::forward<Args>(args)...);
     else
         throw logic_error("enqueue() while queue is full");
 }
@@ -106,7 +168,7 @@ DataType QueueLinked<DataType>::dequeue() throw (logic_error)
     if(!isEmpty())
     {
         QueueNode* temp = front->next;
-        DataType tempData = front->dataItem;
+        DataType tempData = std::move(front->dataItem);
         delete front;
         front = temp;
         return tempData;
@@ -185,7 +247,7 @@ DataType QueueLinked<DataType>::getRear() throw (logic_error)
         if(back != front)
         {
             QueueNode* temp = back;
-            DataType tempData = back->dataItem;
+            DataType tempData = std::move(back->dataItem);
             back = front;
             while (back->next != temp)
                 back = back->next;
@@ -195,7 +257,7 @@ DataType QueueLinked<DataType>::getRear() throw (logic_error)
         }
         else
         {
-            DataType tempData = front->dataItem;
+            DataType tempData = std::move(front->dataItem);
             delete front;
             front = back = NULL;
             return tempData;
@@ -253,6 +315,74 @@ void QueueLinked<DataType>::showStructure() const
     }
 }
 
+/** Inserts the count data items
+* of newDataItems at the rear of the Queue, in order. The new nodes are linked
+* to each other first and then to the Queue in one step.
+* @pre Queue is not full.
+* @param newDataItems is the array of data to be added to the Queue.
+* @param count is the number of data items in newDataItems.
+*/
+template<class DataType>
+void QueueLinked<DataType>::enqueueBatch(const DataType newDataItems[],
+    int count) throw (logic_error)
+{
+    if(count <= 0)
+        return;
+
+    QueueNode* first = new QueueNode(newDataItems[0], NULL);
+    QueueNode* last = first;
+    for(int i = 1; i < count; i++)
+        last = last->next = new QueueNode(newDataItems[i], NULL);
+    if(!isEmpty())
+        back->next = first;
+    else
+        front = first;
+    back = last;
+}
+
+/** Removes up to maxCount data items
+* from the front of the Queue into dataItems, in order.
+* @param dataItems is the array that receives the removed data.
+* @param maxCount is the number of data items dataItems can hold.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueLinked<DataType>::dequeueBatch(DataType dataItems[], int maxCount)
+{
+    int count = 0;
+    while(count < maxCount && front != NULL)
+    {
+        QueueNode* temp = front;
+        dataItems[count++] = std::move(temp->dataItem);
+        front = temp->next;
+        delete temp;
+    }
+    if(front == NULL)
+        back = NULL;
+    return count;
+}
+
+/** Removes all data items
+* from the Queue, appending them to dataItems in Queue order.
+* @param dataItems is the vector that receives the removed data.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueLinked<DataType>::drain(vector<DataType>& dataItems)
+{
+    int count = 0;
+    while(front != NULL)
+    {
+        QueueNode* temp = front;
+        dataItems.push_back(std::move(temp->dataItem));
+        front = temp->next;
+        delete temp;
+        count++;
+    }
+    back = NULL;
+    return count;
+}
+
 //
 // QueueNode Function Implementations //////////////////////////////////////////
 //
@@ -265,8 +395,19 @@ void QueueLinked<DataType>::showStructure() const
 */
 template<class DataType>
 QueueLinked<DataType>::QueueNode::QueueNode(const DataType& nodeData,
-    QueueNode* nextPtr)
+    QueueNode* nextPtr) : dataItem(nodeData), next(nextPtr)
+{
+}
+
+/** The emplacing constructor
+* that constructs the QueueNode's data item in place from args and sets the
+* QueueNode's next pointer to the value of nextPtr.
+* @param nextPtr is the pointer to the next node that this node is linked to.
+* @param args are the constructor arguments for the data item.
+*/
+template<class DataType>
+template<typename... Args>
+QueueLinked<DataType>::QueueNode::QueueNode(QueueNode* nextPtr,
+    Args&&... args) : dataItem(std::forward<Args>(args)...), next(nextPtr)
 {
-    dataItem = nodeData;
-    next = nextPtr;
 }
\ No newline at end of file
@@ -2,20 +2,27 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 using namespace std;
 
 #include "Queue.h"
 
 template <typename DataType>
-class QueueLinked : public Queue<DataType> {
+class QueueLinked final : public Queue<DataType> {
   public:
     QueueLinked(int maxNumber = Queue<DataType>::MAX_QUEUE_SIZE);
     QueueLinked(const QueueLinked& other);
+    QueueLinked(QueueLinked&& other);
     QueueLinked& operator=(const QueueLinked& other);
+    QueueLinked& operator=(QueueLinked&& other);
     ~QueueLinked();
 
     void enqueue(const DataType& newDataItem) throw (logic_error);
+    void enqueue(DataType&& newDataItem) throw (logic_error);
+    template <typename... Args>
+    void emplace(Args&&... args) throw (logic_error);
     DataType dequeue() throw (logic_error);
 
     void clear();
@@ -31,10 +38,18 @@ class QueueLinked : public Queue<DataType> {
 
     void showStructure() const;
 
+    // Batch operations
+    void enqueueBatch(const DataType newDataItems[], int count)
+	throw (logic_error);
+    int dequeueBatch(DataType dataItems[], int maxCount);
+    int drain(vector<DataType>& dataItems);
+
   private:
     class QueueNode {
       public:
 	QueueNode(const DataType& nodeData, QueueNode* nextPtr);
+	template <typename... Args>
+	QueueNode(QueueNode* nextPtr, Args&&... args);
 
 	DataType dataItem;
 	QueueNode* next;
@@ -0,0 +1,407 @@
+/** @file QueueLockFree.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement a lock-free multi-producer,
+* multi-consumer version of a Queue.
+* @details The Queue is a bounded ring of cells. Every cell carries a sequence
+* number that tells whether it is ready to be written by the producer holding
+* ticket pos (sequence == pos) or read by the consumer holding ticket pos
+* (sequence == pos + 1.) Producers and consumers claim tickets with a single
+* compare-and-swap on their own position counter, so no thread ever waits on a
+* lock and a slow thread only delays the cell it holds. Nodes are never
+* allocated or freed after construction, so no memory reclamation scheme is
+* needed.
+* \n The Queue ADT operations keep their meaning: enqueue() throws when the
+* Queue is full and dequeue() throws when it is empty. Concurrent code should
+* use tryEnqueue() and tryDequeue() instead, because isEmpty(), isFull() and
+* getLength() are only snapshots while other threads are running.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "QueueLockFree.h"
+using namespace std;
+
+//
+// Queue Function Implementations //////////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty Queue with room for at least maxNumber data items. The
+* capacity is rounded up to a power of two.
+* @param maxNumber is the minimum number of data items the Queue can hold.
+*/
+template<class DataType>
+QueueLockFree<DataType>::QueueLockFree(int maxNumber)
+{
+    size_t capacity = 2;
+    while(capacity < size_t(maxNumber))
+        capacity *= 2;
+
+    cells = new QueueCell[capacity];
+    mask = capacity - 1;
+    for(size_t i = 0; i < capacity; i++)
+        cells[i].sequence.store(i, memory_order_relaxed);
+    enqueuePos.store(0, memory_order_relaxed);
+    dequeuePos.store(0, memory_order_relaxed);
+}
+
+/** The destructor
+* that deallocates the memory used to store the Queue.
+* @pre No other thread is using the Queue.
+*/
+template<class DataType>
+QueueLockFree<DataType>::~QueueLockFree()
+{
+    delete[] cells;
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue.
+* @pre Queue is not full.
+* @param newDataItem is the data to be added to the Queue.
+* @throw Queue is full.
+*/
+template<class DataType>
+void QueueLockFree<DataType>::enqueue(const DataType& newDataItem)
+    throw (logic_error)
+{
+    if(!push(newDataItem))
+        throw logic_error("enqueue() while queue is full");
+}
+
+/** Moves newDataItem
+* to the rear of the Queue.
+* @pre Queue is not full.
+* @param newDataItem is the data to be moved into the Queue.
+* @throw Queue is full.
+*/
+template<class DataType>
+void QueueLockFree<DataType>::enqueue(DataType&& newDataItem)
+    throw (logic_error)
+{
+    if(!push(std::move(newDataItem)))
+        throw logic_error("enqueue() while queue is full");
+}
+
+/** Removes the data item
+* that was least recently added from the Queue and returns it.
+* @pre Queue is not empty.
+* @return DataType is the data removed from the Queue.
+* @throw Queue is empty.
+*/
+template<class DataType>
+DataType QueueLockFree<DataType>::dequeue() throw (logic_error)
+{
+    DataType dataItem;
+    if(!tryDequeue(dataItem))
+        throw logic_error("dequeue() while queue is empty");
+    return dataItem;
+}
+
+/** Inserts newDataItem
+* at the rear of the Queue if there is room for it. Safe to call from any
+* number of threads at once.
+* @param newDataItem is the data to be added to the Queue.
+* @return True if newDataItem was added. False if the Queue was full.
+*/
+template<class DataType>
+bool QueueLockFree<DataType>::tryEnqueue(const DataType& newDataItem)
+{
+    return push(newDataItem);
+}
+
+/** Moves newDataItem
+* to the rear of the Queue if there is room for it. Safe to call from any
+* number of threads at once.
+* @param newDataItem is the data to be moved into the Queue.
+* @return True if newDataItem was added. False if the Queue was full.
+*/
+template<class DataType>
+bool QueueLockFree<DataType>::tryEnqueue(DataType&& newDataItem)
+{
+    return push(std::move(newDataItem));
+}
+
+/** Removes the least recently added data item
+* into dataItem if the Queue is not empty. Safe to call from any number of
+* threads at once.
+* @param dataItem is set to the data removed from the Queue.
+* @return True if a data item was removed. False if the Queue was empty.
+*/
+template<class DataType>
+bool QueueLockFree<DataType>::tryDequeue(DataType& dataItem)
+{
+    size_t pos;
+    if(claim(dequeuePos, 1, 1, pos) == 0)
+        return false;
+
+    QueueCell* cell = &cells[pos & mask];
+    dataItem = std::move(cell->dataItem);
+    //Hand the cell to the producer one lap ahead
+    cell->sequence.store(pos + mask + 1, memory_order_release);
+    return true;
+}
+
+/** Removes all data items in the Queue.
+* @pre No other thread is using the Queue.
+*/
+template<class DataType>
+void QueueLockFree<DataType>::clear()
+{
+    DataType dataItem;
+    while(tryDequeue(dataItem));
+}
+
+/** Returns true if the Queue is empty.
+* Otherwise, returns false. Only a snapshot while other threads are running.
+* @return The Queue is empty or not.
+*/
+template<class DataType>
+bool QueueLockFree<DataType>::isEmpty() const
+{
+    return (getLength() == 0);
+}
+
+/** Returns true if the Queue is full.
+* Otherwise, returns false. Only a snapshot while other threads are running.
+* @return The Queue is full or not.
+*/
+template<class DataType>
+bool QueueLockFree<DataType>::isFull() const
+{
+    return (size_t(getLength()) > mask);
+}
+
+/** Inserting at the front of the Queue
+* is not supported, since it would let a producer overtake the consumers.
+* @throw Always.
+*/
+template<class DataType>
+void QueueLockFree<DataType>::putFront(const DataType& /*newDataItem*/)
+    throw (logic_error)
+{
+    throw logic_error("putFront() is not supported by a lock-free queue");
+}
+
+/** Removing from the rear of the Queue
+* is not supported, since it would let a consumer overtake the producers.
+* @throw Always.
+*/
+template<class DataType>
+DataType QueueLockFree<DataType>::getRear() throw (logic_error)
+{
+    throw logic_error("getRear() is not supported by a lock-free queue");
+}
+
+/** Returns the number of data items
+* in the Queue. Only a snapshot while other threads are running.
+* @return int is the number of data items in a the Queue.
+*/
+template<class DataType>
+int QueueLockFree<DataType>::getLength() const
+{
+    size_t front = dequeuePos.load(memory_order_acquire);
+    size_t back = enqueuePos.load(memory_order_acquire);
+    return (back > front) ? int(back - front) : 0;
+}
+
+/* Outputs the elements in a Queue.
+* If the Queue is empty, outputs "Empty queue". This operation is intended for
+* testing and debugging purposes only, while no other thread uses the Queue.
+*/
+template<class DataType>
+void QueueLockFree<DataType>::showStructure() const
+{
+    size_t front = dequeuePos.load(memory_order_relaxed);
+    size_t back = enqueuePos.load(memory_order_relaxed);
+
+    if ( front == back )
+    cout << "Empty queue" << endl;
+    else
+    {
+    cout << "Front\t";
+    for ( size_t p = front ; p != back ; p++ )
+    {
+        if( p == front )
+        {
+        cout << '[' << cells[p & mask].dataItem << "] ";
+        }
+        else
+        {
+        cout << cells[p & mask].dataItem << " ";
+        }
+    }
+    cout << "\trear" << endl;
+    }
+}
+
+/** Inserts the count data items
+* of newDataItems at the rear of the Queue.
+* @pre The Queue has room for count more data items.
+* @param newDataItems is the array of data to be added to the Queue.
+* @param count is the number of data items in newDataItems.
+* @throw Queue became full. The data items before the first one that did not
+* fit have been added.
+*/
+template<class DataType>
+void QueueLockFree<DataType>::enqueueBatch(const DataType newDataItems[],
+    int count) throw (logic_error)
+{
+    if(tryEnqueueBatch(newDataItems, count) < count)
+        throw logic_error("enqueueBatch() while queue is full");
+}
+
+/** Inserts as many as possible
+* of the count data items of newDataItems at the rear of the Queue. Every run of
+* free cells is claimed with a single compare-and-swap, so the data items of
+* one run stay together even with other producers running. Safe to call from
+* any number of threads at once.
+* @param newDataItems is the array of data to be added to the Queue.
+* @param count is the number of data items in newDataItems.
+* @return int is the number of leading data items of newDataItems that were
+* added. Less than count if the Queue became full.
+*/
+template<class DataType>
+int QueueLockFree<DataType>::tryEnqueueBatch(const DataType newDataItems[],
+    int count)
+{
+    int done = 0;
+    while(done < count)
+    {
+        size_t pos;
+        size_t claimed = claim(enqueuePos, 0, count - done, pos);
+        if(claimed == 0)
+            break;
+        for(size_t i = 0; i < claimed; i++, pos++)
+        {
+            QueueCell* cell = &cells[pos & mask];
+            cell->dataItem = newDataItems[done++];
+            cell->sequence.store(pos + 1, memory_order_release);
+        }
+    }
+    return done;
+}
+
+/** Removes up to maxCount data items
+* from the front of the Queue into dataItems, in order. Every run of filled
+* cells is claimed with a single compare-and-swap. Safe to call from any number
+* of threads at once.
+* @param dataItems is the array that receives the removed data.
+* @param maxCount is the number of data items dataItems can hold.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueLockFree<DataType>::dequeueBatch(DataType dataItems[], int maxCount)
+{
+    int done = 0;
+    while(done < maxCount)
+    {
+        size_t pos;
+        size_t claimed = claim(dequeuePos, 1, maxCount - done, pos);
+        if(claimed == 0)
+            break;
+        for(size_t i = 0; i < claimed; i++, pos++)
+        {
+            QueueCell* cell = &cells[pos & mask];
+            dataItems[done++] = std::move(cell->dataItem);
+            cell->sequence.store(pos + mask + 1, memory_order_release);
+        }
+    }
+    return done;
+}
+
+/** Removes every data item
+* that is in the Queue, appending them to dataItems in Queue order. Safe to
+* call from any number of threads at once.
+* @param dataItems is the vector that receives the removed data.
+* @return int is the number of data items removed.
+*/
+template<class DataType>
+int QueueLockFree<DataType>::drain(vector<DataType>& dataItems)
+{
+    int done = 0;
+    while(true)
+    {
+        size_t pos;
+        size_t claimed = claim(dequeuePos, 1, mask + 1, pos);
+        if(claimed == 0)
+            break;
+        for(size_t i = 0; i < claimed; i++, pos++)
+        {
+            QueueCell* cell = &cells[pos & mask];
+            dataItems.push_back(std::move(cell->dataItem));
+            cell->sequence.store(pos + mask + 1, memory_order_release);
+        }
+        done += int(claimed);
+    }
+    return done;
+}
+
+/** Claims the cell for the next producer ticket
+* and stores newDataItem in it.
+* @param newDataItem is the data to be copied or moved into the Queue.
+* @return True if newDataItem was added. False if the Queue was full.
+*/
+template<class DataType>
+template<typename ItemType>
+bool QueueLockFree<DataType>::push(ItemType&& newDataItem)
+{
+    size_t pos;
+    if(claim(enqueuePos, 0, 1, pos) == 0)
+        return false;
+
+    QueueCell* cell = &cells[pos & mask];
+    cell->dataItem = std::forward<ItemType>(newDataItem);
+    //Publish the data item to the consumer holding this ticket
+    cell->sequence.store(pos + 1, memory_order_release);
+    return true;
+}
+
+/** Claims a run of up to maxCount tickets
+* from position. The cell for ticket pos is ready when its sequence is
+* pos + ready: producers pass enqueuePos and 0, consumers pass dequeuePos and 1.
+* The whole run is claimed with a single compare-and-swap.
+* @param position is the ticket counter of the claiming side.
+* @param ready is the offset of the sequence of a ready cell from its ticket.
+* @param maxCount is the largest number of tickets to claim.
+* @param pos is set to the first claimed ticket.
+* @return size_t is the number of tickets claimed. Zero if the Queue was full
+* (for producers) or empty (for consumers.)
+*/
+template<class DataType>
+size_t QueueLockFree<DataType>::claim(atomic<size_t>& position, size_t ready,
+    size_t maxCount, size_t& pos)
+{
+    pos = position.load(memory_order_relaxed);
+    while(true)
+    {
+        //Count the ready cells from pos on
+        size_t count = 0;
+        while(count < maxCount && count <= mask &&
+            cells[(pos + count) & mask].sequence.load(memory_order_acquire)
+                == pos + count + ready)
+            count++;
+
+        if(count > 0)
+        {
+            //Try to claim them; on failure pos holds the new ticket
+            if(position.compare_exchange_weak(pos, pos + count,
+                memory_order_relaxed))
+                return count;
+        }
+        else
+        {
+            size_t sequence = cells[pos & mask].sequence.load(
+                memory_order_acquire);
+            //Cell still waits for the other side, so the Queue is full (for
+            //producers) or empty (for consumers)
+            if(ptrdiff_t(sequence) - ptrdiff_t(pos + ready) < 0)
+                return 0;
+            //Another thread on this side claimed the cell first
+            pos = position.load(memory_order_relaxed);
+        }
+    }
+}
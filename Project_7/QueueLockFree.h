@@ -0,0 +1,75 @@
+// QueueLockFree.h
+
+#include <stdexcept>
+#include <iostream>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+#include "Queue.h"
+
+template <typename DataType>
+class QueueLockFree final : public Queue<DataType> {
+  public:
+    QueueLockFree(int maxNumber = Queue<DataType>::MAX_QUEUE_SIZE);
+    ~QueueLockFree();
+
+    void enqueue(const DataType& newDataItem) throw (logic_error);
+    void enqueue(DataType&& newDataItem) throw (logic_error);
+    DataType dequeue() throw (logic_error);
+
+    // Non-throwing versions for concurrent producers and consumers
+    bool tryEnqueue(const DataType& newDataItem);
+    bool tryEnqueue(DataType&& newDataItem);
+    bool tryDequeue(DataType& dataItem);
+
+    void clear();
+
+    bool isEmpty() const;
+    bool isFull() const;
+
+    // Programming Exercise 2 (not supported by a lock-free FIFO)
+    void putFront(const DataType& newDataItem) throw (logic_error);
+    DataType getRear() throw (logic_error);
+    // Programming Exercise 3
+    int getLength() const;
+
+    void showStructure() const;
+
+    // Batch operations, each claiming a run of cells with one compare-and-swap
+    void enqueueBatch(const DataType newDataItems[], int count)
+	throw (logic_error);
+    int tryEnqueueBatch(const DataType newDataItems[], int count);
+    int dequeueBatch(DataType dataItems[], int maxCount);
+    int drain(vector<DataType>& dataItems);
+
+  private:
+    // Shared between threads, so copying is not supported
+    QueueLockFree(const QueueLockFree& other);
+    QueueLockFree& operator=(const QueueLockFree& other);
+
+    template <typename ItemType>
+    bool push(ItemType&& newDataItem);
+    size_t claim(atomic<size_t>& position, size_t ready, size_t maxCount,
+		 size_t& pos);
+
+    class QueueCell {
+      public:
+	atomic<size_t> sequence;    // Ticket of the operation allowed next
+	DataType dataItem;
+    };
+
+    static const int CACHE_LINE_SIZE = 64;
+
+    QueueCell* cells;
+    size_t mask;                // Capacity - 1 (capacity is a power of two)
+
+    // Producers and consumers each own a cache line
+    char pad0[CACHE_LINE_SIZE];
+    atomic<size_t> enqueuePos;
+    char pad1[CACHE_LINE_SIZE - sizeof(atomic<size_t>)];
+    atomic<size_t> dequeuePos;
+    char pad2[CACHE_LINE_SIZE - sizeof(atomic<size_t>)];
+};
@@ -0,0 +1,89 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 7                                            StoreSim.h
+//
+//  The store simulation shared by storesim.cpp and replicate.cpp:
+//  one line of customers, one cashier and one-minute steps.
+//
+//--------------------------------------------------------------------
+
+#ifndef STORESIM_H
+#define STORESIM_H
+
+#include "Histogram.h"
+
+using namespace std;
+
+//--------------------------------------------------------------------
+
+struct StoreResults
+{
+    int totalServed;        //Total customers served
+    long totalWait;         //Total waiting time
+    int maxWait;            //Longest wait
+};
+
+//--------------------------------------------------------------------
+
+template <typename QueueType, typename Generator>
+StoreResults simulateStore(int simLength, Generator& random,
+			   Histogram& waitTimes)
+
+// Simulates simLength minutes of customers arriving at and being
+// served from a line of type QueueType. Every minute one customer is
+// served and random() % 4 decides the arrivals: 1 means one new
+// customer, 2 means two, anything else means none. The wait of every
+// customer served is recorded in waitTimes.
+
+{
+    QueueType custQ;
+    StoreResults results = { 0, 0, 0 };
+
+    // SIMULATION VARIABLES //
+    int minute = 0;         //Current Minute
+    int timeArrived = 0;    //Time dequeued customer arrived
+    int waitTime = 0;       //How long dequeued customer waited
+    int numArrivals = 0;    //Number of new arrivals
+    int arrivals[2];        //Arrival times of the new arrivals
+
+    while(minute != simLength)
+    {
+        // Increment Step //
+        minute++;
+        numArrivals = 0;
+
+        // Serve Customer //
+        if (!custQ.isEmpty())
+        {
+            timeArrived = custQ.dequeue();
+            results.totalServed++;
+
+            // Calculate Wait Times //
+            waitTime = minute - timeArrived;
+            results.totalWait += waitTime;
+            waitTimes.record(waitTime);
+            if(waitTime > results.maxWait)
+                results.maxWait = waitTime;
+        }
+
+        // Add Customers //
+        switch (random() % 4)
+        {
+            case 1:
+                numArrivals++;
+                break;
+            case 2:
+                numArrivals += 2;
+                break;
+            default:
+                //Do not add any customers
+                break;
+        }
+        arrivals[0] = arrivals[1] = minute;
+        custQ.enqueueBatch(arrivals, numArrivals);
+    }
+
+    return results;
+}
+
+#endif		// #ifndef STORESIM_H
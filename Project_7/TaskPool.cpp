@@ -0,0 +1,242 @@
+/** @file TaskPool.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement a pool of worker threads that run small
+* tasks with work stealing.
+* @details Every worker owns a DequeStealing of tasks. A task spawned by a
+* worker goes to the bottom of its own deque, and the worker takes its next
+* task from there, so related tasks tend to run on the thread that already has
+* their data in cache. A worker whose deque is empty takes tasks spawned by
+* other threads from a shared injection queue, then steals from the top of the
+* other workers' deques, starting with a random victim. Workers that find
+* nothing for a while sleep until a task is spawned, or for at most a
+* millisecond.
+* \n Tasks are run through a TaskGroup. wait() does not block the calling
+* thread: it runs tasks itself until every task of the group has finished, so
+* tasks can start groups of their own and wait for them without running out of
+* threads. Tasks must not throw exceptions.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "TaskPool.h"
+#include "DequeStealing.cpp"
+#include <chrono>
+
+using namespace std;
+
+thread_local TaskPool* TaskPool::currentPool = NULL;
+thread_local int TaskPool::currentWorker = -1;
+thread_local unsigned TaskPool::stealSeed = 0;
+
+//
+// TaskPool Function Implementations ///////////////////////////////////////////
+//
+
+/** The default constructor
+* that starts numThreads worker threads.
+* @param numThreads is the number of workers. Zero means one per core.
+*/
+TaskPool::TaskPool(int numThreads)
+{
+    if(numThreads < 1)
+        numThreads = max(1u, thread::hardware_concurrency());
+
+    numInjected.store(0);
+    numSleeping.store(0);
+    stopping.store(false);
+    for(int i = 0; i < numThreads; i++)
+        deques.push_back(new DequeStealing<Task*>());
+    for(int i = 0; i < numThreads; i++)
+        workers.push_back(thread(&TaskPool::workerLoop, this, i));
+}
+
+/** The destructor
+* that stops and joins the worker threads.
+* @pre Every TaskGroup using the pool has finished waiting.
+*/
+TaskPool::~TaskPool()
+{
+    stopping.store(true, memory_order_release);
+    {
+        lock_guard<mutex> lock(sleepLock);
+        wakeUp.notify_all();
+    }
+    for(size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+    for(size_t i = 0; i < deques.size(); i++)
+        delete deques[i];
+}
+
+/** Returns the number of worker threads.
+* @return int is the number of worker threads.
+*/
+int TaskPool::getNumThreads() const
+{
+    return workers.size();
+}
+
+/** Returns the pool shared by the whole program.
+* It is created with one worker per core on first use.
+* @return TaskPool& is the shared pool.
+*/
+TaskPool& TaskPool::getShared()
+{
+    static TaskPool sharedPool;
+    return sharedPool;
+}
+
+/** Makes task available to the workers.
+* A worker of this pool pushes it to its own deque; any other thread adds it to
+* the injection queue. A sleeping worker is woken.
+* @param task is the task to be run.
+*/
+void TaskPool::spawn(Task* task)
+{
+    if(currentPool == this)
+        deques[currentWorker]->push(task);
+    else
+    {
+        lock_guard<mutex> lock(injectionLock);
+        injectedTasks.push_back(task);
+        numInjected.fetch_add(1, memory_order_release);
+    }
+
+    if(numSleeping.load(memory_order_acquire) > 0)
+        wakeUp.notify_one();
+}
+
+/** Runs one task
+* if one can be found.
+* @return True if a task was run. False if none was found.
+*/
+bool TaskPool::runOne()
+{
+    Task* task = findTask();
+    if(task == NULL)
+        return false;
+
+    task->work();
+    TaskGroup* group = task->group;
+    delete task;
+    //The group may be destroyed as soon as this reaches zero
+    group->pending.fetch_sub(1, memory_order_release);
+    return true;
+}
+
+/** Returns the next task
+* for the calling thread: from its own deque, then from the injection queue,
+* then stolen from another worker.
+* @return Task* is the task, or NULL if none was found.
+*/
+TaskPool::Task* TaskPool::findTask()
+{
+    Task* task;
+    bool isWorker = (currentPool == this);
+    if(isWorker && deques[currentWorker]->pop(task))
+        return task;
+
+    if(numInjected.load(memory_order_acquire) > 0)
+    {
+        lock_guard<mutex> lock(injectionLock);
+        if(!injectedTasks.empty())
+        {
+            task = injectedTasks.front();
+            injectedTasks.pop_front();
+            numInjected.fetch_sub(1, memory_order_relaxed);
+            return task;
+        }
+    }
+
+    //Steal, starting at a random victim so thieves spread out
+    int numDeques = deques.size();
+    stealSeed = stealSeed * 1103515245 + 12345;
+    int victim = (stealSeed >> 16) % numDeques;
+    for(int i = 0; i < numDeques; i++)
+    {
+        if(!(isWorker && victim == currentWorker) &&
+            deques[victim]->steal(task))
+            return task;
+        if(++victim == numDeques)
+            victim = 0;
+    }
+    return NULL;
+}
+
+/** The loop run by worker index
+* until the pool is destroyed. Spins briefly when out of tasks, then sleeps.
+* @param index is the worker number, which is also its deque.
+*/
+void TaskPool::workerLoop(int index)
+{
+    currentPool = this;
+    currentWorker = index;
+    stealSeed = index + 1;
+
+    int idle = 0;
+    while(!stopping.load(memory_order_acquire))
+    {
+        if(runOne())
+            idle = 0;
+        else if(++idle < SPINS_BEFORE_SLEEP)
+            this_thread::yield();
+        else
+        {
+            //The timeout covers a task spawned just before numSleeping rose
+            unique_lock<mutex> lock(sleepLock);
+            numSleeping.fetch_add(1, memory_order_acq_rel);
+            if(!stopping.load(memory_order_acquire))
+                wakeUp.wait_for(lock, chrono::milliseconds(1));
+            numSleeping.fetch_sub(1, memory_order_acq_rel);
+            idle = 0;
+        }
+    }
+}
+
+//
+// TaskGroup Function Implementations //////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty group running its tasks on pool.
+* @param pool is the pool that runs the tasks, the shared pool by default.
+*/
+TaskGroup::TaskGroup(TaskPool& pool) : pool(pool)
+{
+    pending.store(0);
+}
+
+/** The destructor
+* that waits for the tasks of the group to finish.
+* @see wait()
+*/
+TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+/** Runs work
+* as a task of the group on one of the threads of the pool.
+* @param work is the function to be run.
+*/
+void TaskGroup::run(const function<void()>& work)
+{
+    TaskPool::Task* task = new TaskPool::Task;
+    task->work = work;
+    task->group = this;
+    pending.fetch_add(1, memory_order_relaxed);
+    pool.spawn(task);
+}
+
+/** Waits for every task
+* of the group to finish. The calling thread runs tasks (of any group) while it
+* waits.
+*/
+void TaskGroup::wait()
+{
+    while(pending.load(memory_order_acquire) > 0)
+        if(!pool.runOne())
+            this_thread::yield();
+}
@@ -0,0 +1,88 @@
+// TaskPool.h
+
+#ifndef TASKPOOL_H
+#define TASKPOOL_H
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+using namespace std;
+
+#include "DequeStealing.h"
+
+class TaskGroup;
+
+class TaskPool {
+  public:
+    TaskPool(int numThreads = 0);
+    ~TaskPool();
+
+    int getNumThreads() const;
+
+    // One pool for the whole program, created on first use
+    static TaskPool& getShared();
+
+  private:
+    friend class TaskGroup;
+
+    class Task {
+      public:
+	function<void()> work;
+	TaskGroup* group;
+    };
+
+    // Owns threads, so copying is not supported
+    TaskPool(const TaskPool& other);
+    TaskPool& operator=(const TaskPool& other);
+
+    void spawn(Task* task);
+    bool runOne();
+    Task* findTask();
+    void workerLoop(int index);
+
+    static const int SPINS_BEFORE_SLEEP = 64;
+
+    vector<thread> workers;
+    vector<DequeStealing<Task*>*> deques;   // One per worker
+
+    // Tasks spawned by threads that are not workers of this pool
+    mutex injectionLock;
+    std::deque<Task*> injectedTasks;
+    atomic<int> numInjected;
+
+    // Idle workers sleep here until new tasks are spawned
+    mutex sleepLock;
+    condition_variable wakeUp;
+    atomic<int> numSleeping;
+    atomic<bool> stopping;
+
+    static thread_local TaskPool* currentPool;
+    static thread_local int currentWorker;
+    static thread_local unsigned stealSeed;
+};
+
+class TaskGroup {
+  public:
+    TaskGroup(TaskPool& pool = TaskPool::getShared());
+    ~TaskGroup();
+
+    void run(const function<void()>& work);
+    void wait();
+
+  private:
+    friend class TaskPool;
+
+    TaskGroup(const TaskGroup& other);
+    TaskGroup& operator=(const TaskGroup& other);
+
+    TaskPool& pool;
+    atomic<int> pending;        // Tasks run() but not finished
+};
+
+#endif	// ifndef TASKPOOL_H
@@ -0,0 +1,220 @@
+/** @file eventsim.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program simulates the flow of customers through the checkout
+* lanes of a store, one event at a time.
+* @details Unlike storesim.cpp, which steps through every simulated minute, the
+* simulation jumps from one event to the next: customer arrivals and service
+* completions are kept in a Heap ordered by the time they happen, so idle time
+* costs nothing and time is continuous. Customers arrive as a Poisson process
+* and join the shorter of two randomly chosen lanes, which keeps the lines
+* balanced without scanning every lane. Every lane has one cashier and a
+* QueueArray holding the arrival times of the customers waiting in it.
+* \n The wait statistics are reported per lane and for the whole store,
+* followed by the number of events processed per second.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <random>
+#include "config.h"
+
+#include "QueueArray.cpp"
+#include "Histogram.cpp"
+#include "../Project_11/Heap.cpp"
+#include "../Project_13/Timer.cpp"
+
+using namespace std;
+
+//
+// DATA STRUCTURES /////////////////////////////////////////////////////////////
+//
+
+struct Event
+{
+    double getPriority () const
+        { return time; }         // Returns the priority. Needed by the heap.
+
+    double time;                 // Simulated minute the event happens
+    int lane;                    // Lane finishing a service, NO_LANE if arrival
+};
+
+struct Lane
+{
+    QueueArray<double> line;     // Arrival times of the waiting customers
+    bool busy;                   // Cashier is serving a customer
+    long served;                 // Customers whose service has started
+    double totalWait;            // Total waiting time
+    double maxWait;              // Longest wait
+    double busyTime;             // Service time before simLength
+};
+
+const int NO_LANE = -1;
+
+//
+// MAIN FUNCTION IMPLEMENTATION ////////////////////////////////////////////////
+//
+int main ()
+{
+    // SIMULATION PARAMETERS //
+    int numLanes = 0;           //Number of checkout lanes
+    double simLength = 0;       //Length of Simulation (Simulated Minutes)
+    double arrivalRate = 0;     //Average customers arriving per minute
+    double serviceMean = 0;     //Average minutes to serve a customer
+    char serviceKind = 'E';     //Service time distribution
+
+    cout << endl << "Enter the number of checkout lanes : ";
+    cin >> numLanes;
+    cout << "Enter the length of time to run the simulator : ";
+    cin >> simLength;
+    cout << "Enter the average number of arrivals per minute : ";
+    cin >> arrivalRate;
+    cout << "Enter the average service time in minutes : ";
+    cin >> serviceMean;
+    cout << "Enter the service time distribution "
+        << "((E)xponential, (U)niform, (D)eterministic) : ";
+    cin >> serviceKind;
+
+    if(!cin || numLanes < 1 || arrivalRate <= 0 || serviceMean <= 0)
+    {
+        cout << "input error" << endl;
+        return 1;
+    }
+
+    // RANDOM NUMBER GENERATION //
+    mt19937_64 rng(7);
+    exponential_distribution<double> interarrival(arrivalRate);
+    exponential_distribution<double> exponentialService(1.0 / serviceMean);
+    uniform_real_distribution<double> uniformService(0.0, 2.0 * serviceMean);
+    uniform_int_distribution<int> pickLane(0, numLanes - 1);
+
+    // SIMULATION STATE //
+    // At most one pending arrival plus one service completion per lane
+    Heap<Event, double, Less<double> > events(numLanes + 1);
+    vector<Lane> lanes(numLanes);
+    for(int i = 0; i < numLanes; i++)
+    {
+        lanes[i].busy = false;
+        lanes[i].served = 0;
+        lanes[i].totalWait = lanes[i].maxWait = lanes[i].busyTime = 0;
+    }
+    Histogram waitTimes;        //Waits of all customers served
+    long numEvents = 0;         //Events processed
+    Event event;                //Current event
+
+    Timer timer;
+    timer.start();
+
+    event.time = interarrival(rng);
+    event.lane = NO_LANE;
+    if(event.time < simLength)
+        events.insert(event);
+
+    while(!events.isEmpty())
+    {
+        event = events.remove();
+        numEvents++;
+        double now = event.time;
+        int laneIndex = event.lane;
+
+        if(laneIndex == NO_LANE)
+        {
+            // Customer Arrives //
+            // Join the shorter of two random lanes (counting the customer
+            // being served)
+            int first = pickLane(rng);
+            int second = pickLane(rng);
+            if(lanes[second].line.getLength() + lanes[second].busy <
+               lanes[first].line.getLength() + lanes[first].busy)
+                first = second;
+            laneIndex = first;
+            lanes[laneIndex].line.enqueue(now);
+
+            // Schedule the next arrival //
+            event.time = now + interarrival(rng);
+            event.lane = NO_LANE;
+            if(event.time < simLength)
+                events.insert(event);
+        }
+        else
+            // Cashier Finishes //
+            lanes[laneIndex].busy = false;
+
+        // Serve Customer //
+        Lane& lane = lanes[laneIndex];
+        if(!lane.busy && !lane.line.isEmpty())
+        {
+            double waitTime = now - lane.line.dequeue();
+            lane.served++;
+            lane.totalWait += waitTime;
+            if(waitTime > lane.maxWait)
+                lane.maxWait = waitTime;
+            waitTimes.record(waitTime);
+
+            double serviceTime;
+            switch(serviceKind)
+            {
+                case 'U': case 'u':
+                    serviceTime = uniformService(rng);
+                    break;
+                case 'D': case 'd':
+                    serviceTime = serviceMean;
+                    break;
+                default:
+                    serviceTime = exponentialService(rng);
+                    break;
+            }
+            lane.busy = true;
+            // Customers in line at simLength are still served, but only
+            // the service before simLength counts toward the utilization
+            if(now < simLength)
+                lane.busyTime += min(serviceTime, simLength - now);
+            event.time = now + serviceTime;
+            event.lane = laneIndex;
+            events.insert(event);
+        }
+    }
+
+    timer.stop();
+
+    // Display Results //
+    long totalServed = 0;
+    double totalWait = 0;
+    double maxWait = 0;
+    cout << endl << setw(6) << "Lane" << setw(12) << "Served"
+        << setw(14) << "Average wait" << setw(14) << "Longest wait"
+        << setw(13) << "Utilization" << endl;
+    cout << fixed << setprecision(2);
+    for(int i = 0; i < numLanes; i++)
+    {
+        cout << setw(6) << i << setw(12) << lanes[i].served
+            << setw(14) << (lanes[i].served ?
+                lanes[i].totalWait / lanes[i].served : 0.0)
+            << setw(14) << lanes[i].maxWait
+            << setw(13) << lanes[i].busyTime / simLength << endl;
+        totalServed += lanes[i].served;
+        totalWait += lanes[i].totalWait;
+        if(lanes[i].maxWait > maxWait)
+            maxWait = lanes[i].maxWait;
+    }
+
+    cout << endl;
+    cout << "Customers served : " << totalServed << endl;
+    cout << "Average wait     : "
+        << (totalServed ? totalWait / totalServed : 0.0) << endl;
+    cout << "Longest wait     : " << maxWait << endl;
+    cout << "Wait times       : ";
+    waitTimes.showSummary();
+    cout << "Events processed : " << numEvents << " in "
+        << timer.getElapsedTime() << " sec ("
+        << numEvents / timer.getElapsedTime() / 1e6 << " M events/sec)"
+        << endl;
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/** @file replicate.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program runs many independent replications of the store
+* simulation in parallel and summarizes their results.
+* @details Every replication runs the same model as storesim.cpp (see
+* StoreSim.h) with its own mt19937_64 random number stream, seeded from the
+* base seed and the replication number. The results therefore do not depend on
+* the number of threads or on which thread ran which replication, and rerunning
+* with the same seed reproduces them exactly. Threads take the next replication
+* number from a shared counter and write their results to the slot for that
+* replication, so they never wait on each other.
+* \n For the average and the longest wait of each replication, the program
+* reports the mean with a 95% confidence interval, percentiles across the
+* replications and the maximum. Every thread also records the waits of its
+* customers in its own Histogram; these are merged into the distribution of
+* the waits of all customers. The replications per second are reported last.
+* Build with -pthread.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include "config.h"
+
+#include "QueueArray.cpp"
+#include "Histogram.cpp"
+#include "StoreSim.h"
+#include "../Project_13/Timer.cpp"
+
+using namespace std;
+
+//
+// FUNCTION PROTOTYPES /////////////////////////////////////////////////////////
+//
+
+void runReplications(int simLength, unsigned long seed, int numReplications,
+    atomic<int>& nextReplication, vector<double>& averageWaits,
+    vector<double>& longestWaits, Histogram& waitTimes);
+void showSummary(const string& name, vector<double>& samples);
+
+//
+// MAIN FUNCTION IMPLEMENTATION ////////////////////////////////////////////////
+//
+int main ()
+{
+    int simLength = 0;          //Length of each simulation (Simulated Minutes)
+    int numReplications = 0;    //Number of independent simulations
+    int numThreads = 0;         //Number of threads running simulations
+    unsigned long seed = 7;     //Base seed of the random number streams
+
+    cout << endl << "Enter the length of time to run the simulator : ";
+    cin >> simLength;
+    cout << "Enter the number of replications : ";
+    cin >> numReplications;
+    cout << "Enter the number of threads (0 for one per core) : ";
+    cin >> numThreads;
+    cout << "Enter the random number seed : ";
+    cin >> seed;
+
+    if(!cin || simLength < 1 || numReplications < 1)
+    {
+        cout << "input error" << endl;
+        return 1;
+    }
+    if(numThreads < 1)
+        numThreads = max(1u, thread::hardware_concurrency());
+
+    vector<double> averageWaits(numReplications);
+    vector<double> longestWaits(numReplications);
+    atomic<int> nextReplication(0);
+    vector<thread> threads;
+    vector<Histogram> threadWaitTimes(numThreads);
+    Histogram waitTimes;        //Waits of the customers of all replications
+
+    Timer timer;
+    timer.start();
+    for(int i = 0; i < numThreads; i++)
+        threads.push_back(thread(runReplications, simLength, seed,
+            numReplications, ref(nextReplication), ref(averageWaits),
+            ref(longestWaits), ref(threadWaitTimes[i])));
+    for(int i = 0; i < numThreads; i++)
+    {
+        threads[i].join();
+        waitTimes.merge(threadWaitTimes[i]);
+    }
+    timer.stop();
+
+    // Display Results //
+    cout << endl << numReplications << " replications of " << simLength
+        << " minutes on " << numThreads << " threads" << endl << endl;
+    cout << fixed << setprecision(3);
+    showSummary("Average wait", averageWaits);
+    showSummary("Longest wait", longestWaits);
+    cout << endl << "Wait times of all customers : ";
+    waitTimes.showSummary();
+    cout << endl << "Replications/sec : "
+        << numReplications / timer.getElapsedTime() << endl;
+
+    return 0;
+}
+
+//
+// FUNCTION IMPLEMENTATIONS ////////////////////////////////////////////////////
+//
+
+/** Runs replications
+* until every one of the numReplications replications has been claimed. Each
+* replication uses its own random number stream derived from seed and its
+* replication number.
+* @param simLength is the number of simulated minutes of each replication.
+* @param seed is the base seed of the random number streams.
+* @param numReplications is the total number of replications.
+* @param nextReplication is the number of the next unclaimed replication.
+* @param averageWaits receives the average wait of each replication.
+* @param longestWaits receives the longest wait of each replication.
+* @param waitTimes records the wait of every customer served by this thread.
+*/
+void runReplications(int simLength, unsigned long seed, int numReplications,
+    atomic<int>& nextReplication, vector<double>& averageWaits,
+    vector<double>& longestWaits, Histogram& waitTimes)
+{
+    int replication;
+    while((replication = nextReplication.fetch_add(1)) < numReplications)
+    {
+        seed_seq streamSeed = { seed, (unsigned long)replication };
+        mt19937_64 random(streamSeed);
+        StoreResults results =
+            simulateStore< QueueArray<int> >(simLength, random, waitTimes);
+
+        averageWaits[replication] = results.totalServed ?
+            double(results.totalWait) / results.totalServed : 0.0;
+        longestWaits[replication] = results.maxWait;
+    }
+}
+
+/** Outputs the mean
+* with its 95% confidence interval, the 50th, 90th and 99th percentiles and the
+* extremes of samples.
+* @param name is the label of the statistic.
+* @param samples holds one value per replication. Sorted on return.
+*/
+void showSummary(const string& name, vector<double>& samples)
+{
+    int count = samples.size();
+    double sum = 0;
+    double sumSquares = 0;
+    for(int i = 0; i < count; i++)
+    {
+        sum += samples[i];
+        sumSquares += samples[i] * samples[i];
+    }
+    double mean = sum / count;
+    double variance = (count > 1) ?
+        (sumSquares - sum * mean) / (count - 1) : 0.0;
+    double halfWidth = 1.96 * sqrt(max(variance, 0.0) / count);
+
+    sort(samples.begin(), samples.end());
+    cout << name << " : mean " << mean << " +/- " << halfWidth
+        << "  p50 " << samples[count / 2]
+        << "  p90 " << samples[min(count - 1, count * 9 / 10)]
+        << "  p99 " << samples[min(count - 1, count * 99 / 100)]
+        << "  min " << samples[0]
+        << "  max " << samples[count - 1] << endl;
+}
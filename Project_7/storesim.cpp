@@ -6,6 +6,10 @@
 * @details The specifications of this project match those of the book C++ Data
 * Structures - A Laboratory Course (3rd Edition) Project 7. The shell of this
 * program have been modified form the book mentioned above.
+* \n The Queue implementation is chosen on the command line (linked, array or
+* doubly; LAB7_TEST1 picks the default) and passed to simulate() as a template
+* parameter, so the simulation calls the Queue directly instead of through the
+* Queue<DataType> interface.
 */ 
 
 //
@@ -15,99 +19,89 @@
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include "config.h"
 
-#if LAB7_TEST1
-#   include "QueueLinked.cpp"
-#else
-#   include "QueueArray.cpp"
-#endif
+#include "QueueLinked.cpp"
+#include "QueueArray.cpp"
+#include "QueueDoublyLinked.cpp"
+#include "Histogram.cpp"
+#include "StoreSim.h"
 
 using namespace std;
 
+//
+// FUNCTION PROTOTYPES /////////////////////////////////////////////////////////
+//
+
+template <typename QueueType>
+void simulate(int simLength);
+
 //
 // MAIN FUNCTION IMPLEMENTATION ////////////////////////////////////////////////
 //
-int main ()
+int main (int argc, char* argv[])
 {
     #if LAB7_TEST1
-        QueueLinked<int> custQ;
+        const char* queueName = "linked";
     #else
-        QueueArray<int> custQ;
+        const char* queueName = "array";
     #endif
+    if(argc > 1)
+        queueName = argv[1];
 
-    // SIMULATION VARIABLES //
     int simLength = 0;      //Length of Simulation (Simulated Minutes)
-    int minute = 0;         //Current Minute
-    int timeArrived = 0;    //Time dequeued customer arrived
-    int waitTime = 0;       //How long dequeued customer waited
-    int totalServed = 0;    //Total customers served
-    int totalWait = 0;      //Total waiting time
-    int maxWait = 0;        //Longest wait
-    int numArrivals = 0;    //Number of new arrivals
-    srand(7);           //Seed random number
-    int rng = 0;            //Random number place holder
-
     cout << endl << "Enter the length of time to run the simulator : ";
     cin >> simLength;
 
-    while(minute != simLength)
+    if(strcmp(queueName, "linked") == 0)
+        simulate< QueueLinked<int> >(simLength);
+    else if(strcmp(queueName, "array") == 0)
+        simulate< QueueArray<int> >(simLength);
+    else if(strcmp(queueName, "doubly") == 0)
+        simulate< QueueDoublyLinked<int> >(simLength);
+    else
     {
-        // Increment Step //
-        minute++;
-        numArrivals = 0;
-
-        // Serve Customer //
-        if (!custQ.isEmpty())
-        {
-            timeArrived = custQ.dequeue();
-            totalServed++;
+        cout << "Unknown queue: " << queueName
+            << " (expected linked, array or doubly)" << endl;
+        return 1;
+    }
+    return 0;
+}
 
-            // Calculate Wait Times //
-            waitTime = minute - timeArrived;
-            totalWait += waitTime;
-            if(waitTime > maxWait)
-                maxWait = waitTime;
-        }
+//
+// FUNCTION IMPLEMENTATIONS ////////////////////////////////////////////////////
+//
 
-        // Add Customers //
-        rng = rand() % 4;
-        switch (rng)
-        {
-            case 0:
-                //Do not add any customers
-                break;
-            case 1:
-                custQ.enqueue(minute);
-                numArrivals++;
-                break;
-            case 2:
-                custQ.enqueue(minute);
-                custQ.enqueue(minute);
-                numArrivals += 2;
-                break;
-            case 3:
-                //Do not add any customers
-                break;
-            default:
-                //Do not add any customers
-                break;
-        }
+/** Returns the next number
+* from the C library random number generator.
+*/
+int libraryRandom()
+{
+    return rand();
+}
 
-        // Display Updates //
-        //cout << endl;
-        //cout << "Current Minute           : " << minute << endl;
-        //cout << "Time Dequeued Arrived    : " << timeArrived << endl;
-        //cout << "Dequeued Customer Waited : " << waitTime << endl;
-        //cout << "Number of new arrivals   : " << numArrivals << endl;
-        // Apparently I don't need the above....
-    }
+/** Simulates simLength minutes
+* of customers arriving at and being served from a line of type QueueType, then
+* displays the results.
+* @param simLength is the number of simulated minutes.
+* @see simulateStore()
+*/
+template <typename QueueType>
+void simulate(int simLength)
+{
+    srand(7);           //Seed random number
+    Histogram waitTimes;
+    StoreResults results = simulateStore<QueueType>(simLength, libraryRandom,
+        waitTimes);
 
     // Display Results //
     cout << endl;
-    cout << "Customers served : " << totalServed << endl;
+    cout << "Customers served : " << results.totalServed << endl;
     cout << "Average wait     : " << setprecision(2) 
-        << double(totalWait)/totalServed << endl;
-    cout << "Longest wait     : " << maxWait << endl;
-}
\ No newline at end of file
+        << double(results.totalWait)/results.totalServed << endl;
+    cout << "Longest wait     : " << results.maxWait << endl;
+    cout << "Wait times       : ";
+    waitTimes.showSummary();
+}
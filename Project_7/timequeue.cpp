@@ -0,0 +1,475 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 7                                         timequeue.cpp
+//
+//  Compares the performance of the implementations of the Queue ADT
+//  Build with -pthread.
+//
+//--------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <chrono>
+
+#include "config.h"
+
+using namespace std;
+
+#include "QueueLinked.cpp"
+#include "QueueArray.cpp"
+#include "QueueDoublyLinked.cpp"
+#include "QueueLockFree.cpp"
+#include "QueueBlocking.cpp"
+#include "Histogram.cpp"
+#include "../Project_13/Timer.cpp"
+
+//--------------------------------------------------------------------
+//
+// Moved-from queues
+//
+
+// A moved-from QueueArray has no array. Checks that it, and a queue
+// copied from it, grow again when data items are added to them.
+void checkMovedFrom()
+{
+    QueueArray<int> source(4);
+    QueueArray<int> target(std::move(source));
+    QueueArray<int> copy;
+    copy = source;
+    int batch[] = { 3, 4, 5 };
+    bool isCorrect = true;
+
+    source.enqueue(2);
+    source.putFront(1);
+    source.enqueueBatch(batch, 3);
+    for (int i = 1; i <= 5; ++i)
+	isCorrect = isCorrect && source.dequeue() == i;
+    copy.enqueue(1);
+    isCorrect = isCorrect && copy.dequeue() == 1 && target.isEmpty();
+    cout << "Moved-from QueueArray : " << (isCorrect ? "OK" : "FAILED")
+	 << endl;
+}
+
+//--------------------------------------------------------------------
+//
+// Single-threaded enqueue/dequeue churn
+//
+
+// Keeps about queueLength ints waiting in testQueue while numItems pass
+// through it, as the store simulation does, and reports the throughput.
+template <typename QueueType>
+void timeChurn(QueueType& testQueue, int queueLength, int numItems,
+	       const string& name)
+{
+    long checksum = 0;
+
+    Timer t;
+    t.start();
+    for (int i = 0; i < queueLength; ++i)
+	testQueue.enqueue(i);
+    for (int i = queueLength; i < numItems; ++i) {
+	checksum += testQueue.dequeue();
+	testQueue.enqueue(i);
+    }
+    while (!testQueue.isEmpty())
+	checksum += testQueue.dequeue();
+    t.stop();
+
+    cout << name << " length " << queueLength << " : "
+	 << numItems / t.getElapsedTime() / 1e6 << " M items/sec"
+	 << " (checksum " << checksum << ")" << endl;
+}
+
+void timeSequential(int numItems)
+{
+    const int lengths[] = { 8, 1000, 100000 };
+    for (int i = 0; i < 3; ++i) {
+	QueueLinked<int> linked;
+	timeChurn(linked, lengths[i], numItems, "QueueLinked       ");
+	QueueDoublyLinked<int> doubly;
+	timeChurn(doubly, lengths[i], numItems, "QueueDoublyLinked ");
+	QueueArray<int> growing;
+	timeChurn(growing, lengths[i], numItems, "QueueArray        ");
+	QueueArray<int> fixed(lengths[i], true);
+	timeChurn(fixed, lengths[i], numItems, "QueueArray (fixed)");
+    }
+}
+
+// Uses testQueue as a deque holding queueLength ints: every operation
+// moves the rear data item to the front and checks the length, as the
+// simulations do when they re-queue a customer.
+template <typename QueueType>
+void timeDeque(QueueType& testQueue, int queueLength, int numOps,
+	       const string& name)
+{
+    long checksum = 0;
+    for (int i = 0; i < queueLength; ++i)
+	testQueue.enqueue(i);
+
+    Timer t;
+    t.start();
+    for (int i = 0; i < numOps; ++i) {
+	int dataItem = testQueue.getRear();
+	checksum += dataItem;
+	testQueue.putFront(dataItem);
+	checksum += testQueue.getLength();
+    }
+    t.stop();
+
+    cout << name << " length " << queueLength << " : "
+	 << numOps / t.getElapsedTime() / 1e6 << " M ops/sec"
+	 << " (checksum " << checksum << ")" << endl;
+}
+
+void timeDeques(int numItems)
+{
+    const int lengths[] = { 8, 1000 };
+    int numOps = numItems / 100;
+    for (int i = 0; i < 2; ++i) {
+	QueueLinked<int> linked;
+	timeDeque(linked, lengths[i], numOps, "QueueLinked       ");
+	QueueDoublyLinked<int> doubly;
+	timeDeque(doubly, lengths[i], numOps, "QueueDoublyLinked ");
+	QueueArray<int> array;
+	timeDeque(array, lengths[i], numOps, "QueueArray        ");
+    }
+}
+
+// Passes numItems ints through testQueue batchSize at a time, through the
+// Queue<int> interface as generic code would, and reports the throughput.
+void timeBatchChurn(Queue<int>& testQueue, int batchSize, int numItems,
+		    const string& name)
+{
+    vector<int> batch(batchSize);
+    long checksum = 0;
+
+    Timer t;
+    t.start();
+    for (int i = 0; i + batchSize <= numItems; i += batchSize) {
+	for (int j = 0; j < batchSize; ++j)
+	    batch[j] = i + j;
+	if (batchSize == 1) {
+	    testQueue.enqueue(batch[0]);
+	    checksum += testQueue.dequeue();
+	}
+	else {
+	    testQueue.enqueueBatch(&batch[0], batchSize);
+	    int count = testQueue.dequeueBatch(&batch[0], batchSize);
+	    for (int j = 0; j < count; ++j)
+		checksum += batch[j];
+	}
+    }
+    t.stop();
+
+    cout << name << " batch " << batchSize << " : "
+	 << numItems / t.getElapsedTime() / 1e6 << " M items/sec"
+	 << " (checksum " << checksum << ")" << endl;
+}
+
+void timeBatches(int numItems)
+{
+    const int batchSizes[] = { 1, 16, 256 };
+    for (int i = 0; i < 3; ++i) {
+	QueueLinked<int> linked;
+	timeBatchChurn(linked, batchSizes[i], numItems, "QueueLinked       ");
+	QueueDoublyLinked<int> doubly;
+	timeBatchChurn(doubly, batchSizes[i], numItems, "QueueDoublyLinked ");
+	QueueArray<int> array;
+	timeBatchChurn(array, batchSizes[i], numItems, "QueueArray        ");
+	QueueLockFree<int> lockFree(1024);
+	timeBatchChurn(lockFree, batchSizes[i], numItems, "QueueLockFree     ");
+    }
+}
+
+// Runs the same churn through the Queue<int> interface (virtual calls) and
+// through the concrete class (direct calls, since the classes are final).
+void timeDispatch(int numItems)
+{
+    QueueLinked<int> linked;
+    QueueArray<int> array;
+    QueueDoublyLinked<int> doubly;
+    Queue<int>* queues[] = { &linked, &array, &doubly };
+    const string names[] = { "QueueLinked       ", "QueueArray        ",
+			     "QueueDoublyLinked " };
+
+    for (int i = 0; i < 3; ++i)
+	timeChurn<Queue<int> >(*queues[i], 8, numItems, names[i] + " virtual");
+    timeChurn(linked, 8, numItems, names[0] + " static ");
+    timeChurn(array, 8, numItems, names[1] + " static ");
+    timeChurn(doubly, 8, numItems, names[2] + " static ");
+}
+
+//--------------------------------------------------------------------
+//
+// Multi-producer / multi-consumer hand-off
+//
+
+// QueueLinked made thread safe the usual way: one mutex around every call.
+template <typename DataType>
+class LockedQueue {
+  public:
+    bool tryEnqueue(const DataType& newDataItem) {
+	lock_guard<mutex> lock(queueLock);
+	queue.enqueue(newDataItem);
+	return true;
+    }
+
+    bool tryDequeue(DataType& dataItem) {
+	lock_guard<mutex> lock(queueLock);
+	if (queue.isEmpty())
+	    return false;
+	dataItem = queue.dequeue();
+	return true;
+    }
+
+    int tryEnqueueBatch(const DataType newDataItems[], int count) {
+	lock_guard<mutex> lock(queueLock);
+	queue.enqueueBatch(newDataItems, count);
+	return count;
+    }
+
+    int dequeueBatch(DataType dataItems[], int maxCount) {
+	lock_guard<mutex> lock(queueLock);
+	return queue.dequeueBatch(dataItems, maxCount);
+    }
+
+  private:
+    mutex queueLock;
+    QueueLinked<DataType> queue;
+};
+
+// Moves numItems ints from numProducers threads to numConsumers threads
+// through testQueue and reports the throughput in items per second.
+template <typename QueueType>
+void timeHandOff(QueueType& testQueue, int numProducers, int numConsumers,
+		 int numItems, const string& name)
+{
+    atomic<int> numConsumed(0);
+    atomic<long> checksum(0);
+    vector<thread> threads;
+    int perProducer = numItems / numProducers;
+    int total = perProducer * numProducers;
+
+    Timer t;
+    t.start();
+    for (int p = 0; p < numProducers; ++p) {
+	threads.push_back(thread([&testQueue, perProducer]() {
+	    for (int i = 0; i < perProducer; ++i) {
+		while (!testQueue.tryEnqueue(i))
+		    this_thread::yield();
+	    }
+	}));
+    }
+    for (int c = 0; c < numConsumers; ++c) {
+	threads.push_back(thread([&testQueue, &numConsumed, &checksum, total]() {
+	    long sum = 0;
+	    int dataItem;
+	    while (numConsumed.load(memory_order_relaxed) < total) {
+		if (testQueue.tryDequeue(dataItem)) {
+		    sum += dataItem;
+		    numConsumed.fetch_add(1, memory_order_relaxed);
+		}
+		else
+		    this_thread::yield();
+	    }
+	    checksum += sum;
+	}));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+	threads[i].join();
+    t.stop();
+
+    cout << name << " " << numProducers << "P/" << numConsumers << "C : "
+	 << total / t.getElapsedTime() / 1e6 << " M items/sec"
+	 << " (checksum " << checksum << ")" << endl;
+}
+
+// As timeHandOff, but producers and consumers move batchSize ints at a time.
+template <typename QueueType>
+void timeBatchHandOff(QueueType& testQueue, int numProducers,
+		      int numConsumers, int batchSize, int numItems,
+		      const string& name)
+{
+    atomic<int> numConsumed(0);
+    atomic<long> checksum(0);
+    vector<thread> threads;
+    int perProducer = numItems / numProducers / batchSize * batchSize;
+    int total = perProducer * numProducers;
+
+    Timer t;
+    t.start();
+    for (int p = 0; p < numProducers; ++p) {
+	threads.push_back(thread([&testQueue, perProducer, batchSize]() {
+	    vector<int> batch(batchSize);
+	    for (int i = 0; i < perProducer; i += batchSize) {
+		for (int j = 0; j < batchSize; ++j)
+		    batch[j] = i + j;
+		int done = 0;
+		while ((done += testQueue.tryEnqueueBatch(&batch[done],
+			    batchSize - done)) < batchSize)
+		    this_thread::yield();
+	    }
+	}));
+    }
+    for (int c = 0; c < numConsumers; ++c) {
+	threads.push_back(thread([&testQueue, &numConsumed, &checksum, total,
+				  batchSize]() {
+	    vector<int> batch(batchSize);
+	    long sum = 0;
+	    while (numConsumed.load(memory_order_relaxed) < total) {
+		int count = testQueue.dequeueBatch(&batch[0], batchSize);
+		if (count > 0) {
+		    for (int j = 0; j < count; ++j)
+			sum += batch[j];
+		    numConsumed.fetch_add(count, memory_order_relaxed);
+		}
+		else
+		    this_thread::yield();
+	    }
+	    checksum += sum;
+	}));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+	threads[i].join();
+    t.stop();
+
+    cout << name << " " << numProducers << "P/" << numConsumers << "C"
+	 << " batch " << batchSize << " : "
+	 << total / t.getElapsedTime() / 1e6 << " M items/sec"
+	 << " (checksum " << checksum << ")" << endl;
+}
+
+void timeConcurrent(int numItems)
+{
+    const int counts[][2] = { {1, 1}, {2, 2}, {4, 4}, {1, 4}, {4, 1} };
+    for (int i = 0; i < 5; ++i) {
+	LockedQueue<int> locked;
+	timeHandOff(locked, counts[i][0], counts[i][1], numItems,
+		    "mutex + QueueLinked");
+	QueueLockFree<int> lockFree(1024);
+	timeHandOff(lockFree, counts[i][0], counts[i][1], numItems,
+		    "QueueLockFree      ");
+    }
+    for (int i = 0; i < 5; ++i) {
+	LockedQueue<int> locked;
+	timeBatchHandOff(locked, counts[i][0], counts[i][1], 16, numItems,
+			 "mutex + QueueLinked");
+	QueueLockFree<int> lockFree(1024);
+	timeBatchHandOff(lockFree, counts[i][0], counts[i][1], 16, numItems,
+			 "QueueLockFree      ");
+    }
+}
+
+//--------------------------------------------------------------------
+//
+// Blocking producer / consumer hand-off
+//
+
+// Time since an arbitrary fixed point, in nanoseconds.
+long long nowNanoseconds()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(
+	chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Moves numItems time stamps from numProducers threads to numConsumers
+// threads through a QueueBlocking of capacity 1024, batchSize at a time.
+// Producers block when it is full and consumers when it is empty; the
+// consumers stop once the queue has been closed and drained. Reports the
+// throughput and the time each item spent between producer and consumer.
+void timeBlockingHandOff(int numProducers, int numConsumers, int batchSize,
+			 int numItems)
+{
+    QueueBlocking<long long> testQueue(1024);
+    vector<Histogram> latencies(numConsumers);
+    vector<thread> producers, consumers;
+    int perProducer = numItems / numProducers / batchSize * batchSize;
+
+    Timer t;
+    t.start();
+    for (int p = 0; p < numProducers; ++p) {
+	producers.push_back(thread([&testQueue, perProducer, batchSize]() {
+	    vector<long long> batch(batchSize);
+	    for (int i = 0; i < perProducer; i += batchSize) {
+		if (batchSize == 1)
+		    testQueue.enqueue(nowNanoseconds());
+		else {
+		    for (int j = 0; j < batchSize; ++j)
+			batch[j] = nowNanoseconds();
+		    testQueue.enqueueBatch(&batch[0], batchSize);
+		}
+	    }
+	}));
+    }
+    for (int c = 0; c < numConsumers; ++c) {
+	consumers.push_back(thread([&testQueue, &latencies, c, batchSize]() {
+	    vector<long long> batch(batchSize);
+	    while (true) {
+		int count;
+		if (batchSize == 1) {
+		    try {
+			batch[0] = testQueue.dequeue();
+			count = 1;
+		    }
+		    catch (logic_error&) {
+			break;          // Closed and empty
+		    }
+		}
+		else if ((count = testQueue.dequeueBatch(&batch[0],
+							 batchSize)) == 0)
+		    break;
+		long long now = nowNanoseconds();
+		for (int j = 0; j < count; ++j)
+		    latencies[c].record((now - batch[j]) / 1e3);
+	    }
+	}));
+    }
+    for (size_t i = 0; i < producers.size(); ++i)
+	producers[i].join();
+    testQueue.close();
+    for (size_t i = 0; i < consumers.size(); ++i)
+	consumers[i].join();
+    t.stop();
+
+    Histogram latency;
+    for (int c = 0; c < numConsumers; ++c)
+	latency.merge(latencies[c]);
+    cout << "QueueBlocking " << numProducers << "P/" << numConsumers << "C"
+	 << " batch " << batchSize << " : "
+	 << latency.getCount() / t.getElapsedTime() / 1e6 << " M items/sec"
+	 << ", latency usec p50 " << latency.getPercentile(50)
+	 << " p99 " << latency.getPercentile(99)
+	 << " max " << latency.getMax() << endl;
+}
+
+void timeBlocking(int numItems)
+{
+    const int counts[][2] = { {1, 1}, {4, 4}, {1, 4}, {4, 1} };
+    for (int i = 0; i < 4; ++i) {
+	timeBlockingHandOff(counts[i][0], counts[i][1], 1, numItems);
+	timeBlockingHandOff(counts[i][0], counts[i][1], 16, numItems);
+    }
+}
+
+//--------------------------------------------------------------------
+
+int main()
+{
+    cout << endl << "Enter the number of data items to test: ";
+    int numItems;
+    cin >> numItems;
+
+    checkMovedFrom();
+    timeSequential(numItems);
+    timeDeques(numItems);
+    timeBatches(numItems);
+    timeDispatch(numItems);
+    timeConcurrent(numItems);
+    timeBlocking(numItems);
+
+    return 0;
+}
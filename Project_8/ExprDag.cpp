@@ -0,0 +1,421 @@
+/** @file ExprDag.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement a hash-consed expression DAG, in which
+* identical subexpressions are stored once and shared.
+* @details An ExprTree stores every subexpression as its own subtree, so a
+* subexpression that appears many times is copied, compared and evaluated
+* many times. An ExprDag keeps one node for every distinct subexpression.
+* Nodes are made bottom up, and a node is only added if no node with the same
+* operator and the same children exists already; otherwise the existing node
+* is returned. This is called hash-consing.
+* \n Since children are shared, two nodes stand for the same expression only
+* if they are the same node, so isIdentical() compares two integers. A node is
+* a plain integer handle, so an expression is copied by copying its handle.
+* Every node also keeps a hash of its whole subexpression, computed once from
+* the hashes of its children. It depends only on the expression, not on the
+* order the nodes were made in, so expressions in different DAGs can be
+* compared by hash.
+* \n The nodes are kept in a vector in the order they were made, which puts
+* every child before its parents. Evaluation runs forward over the vector, so
+* a shared subexpression is evaluated once no matter how often it is used.
+* The nodes are found by hash in an open addressing table of node indexes.
+* \n Variables are identified by name, and numbered in the order they first
+* appear. ExprTree::intern() adds an expression tree to a DAG.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "ExprDag.h"
+#include <functional>
+#include <cstring>
+using namespace std;
+
+//
+// ExprDag Implementations /////////////////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty DAG.
+* @post This DAG will be a valid empty DAG.
+*/
+template<typename DataType>
+ExprDag<DataType>::ExprDag()
+{
+    clear();
+}
+
+/** Returns the node
+* of a constant, adding it if the DAG does not have it yet. Constants are the
+* same only if they have the same bits, so -0 does not share the node of 0:
+* x - 0 and x - -0 differ when x is -0.
+* @param value is the value of the constant.
+* @return int is the node.
+*/
+template<typename DataType>
+int ExprDag<DataType>::makeConstant(const DataType& value)
+{
+    Node node;
+    node.dataItem = NUMBER;
+    node.left = node.right = -1;
+    node.value = value;
+    node.variable = -1;
+    node.hash = combineExprHash(combineExprHash(0, NUMBER),
+        valueHash(value));
+    return insert(node);
+}
+
+/** Returns the node
+* of a variable, adding it if the DAG does not have it yet. A new variable gets
+* the next index.
+* @param name is the name of the variable.
+* @return int is the node.
+*/
+template<typename DataType>
+int ExprDag<DataType>::makeVariable(const string& name)
+{
+    int index = variableNames.add(name);
+
+    Node node;
+    node.dataItem = VARIABLE;
+    node.left = node.right = -1;
+    node.value = DataType();
+    node.variable = index;
+    node.hash = combineExprHash(combineExprHash(0, VARIABLE),
+        hash<string>()(name));
+    return insert(node);
+}
+
+/** Returns the node
+* of an operator applied to two nodes, adding it if the DAG does not have it
+* yet.
+* @param op is one of '+', '-', '*' and '/'.
+* @param left is the node of the left operand.
+* @param right is the node of the right operand.
+* @return int is the node.
+* @throw The operator is unknown, or an operand is not a node of this DAG.
+*/
+template<typename DataType>
+int ExprDag<DataType>::makeOperator(char op, int left, int right)
+    throw (logic_error)
+{
+    if(op != '+' && op != '-' && op != '*' && op != '/')
+        throw logic_error("makeOperator() with an unknown operator");
+    checkNode(left);
+    checkNode(right);
+
+    Node node;
+    node.dataItem = op;
+    node.left = left;
+    node.right = right;
+    node.value = DataType();
+    node.variable = -1;
+    node.hash = combineExprHash(combineExprHash(combineExprHash(0, op),
+        nodes[left].hash), nodes[right].hash);
+    return insert(node);
+}
+
+/** Removes all the nodes
+* and variables from the DAG.
+* @post This DAG will be empty.
+*/
+template<typename DataType>
+void ExprDag<DataType>::clear()
+{
+    nodes.clear();
+    table.assign(16, -1);
+    variableNames.clear();
+}
+
+/** Returns the value
+* of the expression of a node. Only the nodes it uses are evaluated, once each.
+* @param node is the node to evaluate.
+* @param variables holds the values of the variables in the order of their
+* indexes. It may be NULL if the expression has no variables.
+* @return The value of the expression.
+* @throw node is not a node of this DAG, or the expression has variables and
+* none are given.
+*/
+template<typename DataType>
+DataType ExprDag<DataType>::evaluate(int node,
+    const DataType variables[]) const throw (logic_error)
+{
+    checkNode(node);
+
+    //Mark the nodes the expression uses, parents before children
+    vector<char> used(node + 1, false);
+    used[node] = true;
+    for(int i = node; i >= 0; i--)
+    {
+        if(used[i] && nodes[i].left >= 0)
+        {
+            used[nodes[i].left] = true;
+            used[nodes[i].right] = true;
+        }
+    }
+
+    //Evaluate them, children before parents
+    vector<DataType> values(node + 1);
+    for(int i = 0; i <= node; i++)
+    {
+        if(!used[i])
+            continue;
+        const Node& p = nodes[i];
+        if(p.dataItem == NUMBER)
+            values[i] = p.value;
+        else if(p.dataItem == VARIABLE)
+        {
+            if(variables == NULL)
+                throw logic_error("evaluate() without the values of the "
+                    "variables");
+            values[i] = variables[p.variable];
+        }
+        else
+            values[i] = applyExprOperator(p.dataItem, values[p.left],
+                values[p.right]);
+    }
+    return values[node];
+}
+
+/** Evaluates every node
+* of the DAG once, which evaluates all of its expressions together.
+* @param variables holds the values of the variables in the order of their
+* indexes. It may be NULL if the DAG has no variables.
+* @param values receives the value of every node, getSize() in all.
+* @throw The DAG has variables and none are given.
+*/
+template<typename DataType>
+void ExprDag<DataType>::evaluateAll(const DataType variables[],
+    DataType values[]) const throw (logic_error)
+{
+    if(variableNames.getCount() != 0 && variables == NULL)
+        throw logic_error("evaluateAll() without the values of the variables");
+
+    for(size_t i = 0; i < nodes.size(); i++)
+    {
+        const Node& p = nodes[i];
+        if(p.dataItem == NUMBER)
+            values[i] = p.value;
+        else if(p.dataItem == VARIABLE)
+            values[i] = variables[p.variable];
+        else
+            values[i] = applyExprOperator(p.dataItem, values[p.left],
+                values[p.right]);
+    }
+}
+
+/** Returns true if two nodes
+* stand for the same expression, operand for operand. Since every distinct
+* expression has one node, this only compares the nodes. Otherwise, returns
+* false.
+* @param first is a node of this DAG.
+* @param second is a node of this DAG.
+* @return The expressions are identical or not.
+*/
+template<typename DataType>
+bool ExprDag<DataType>::isIdentical(int first, int second) const
+{
+    return (first == second);
+}
+
+/** Returns the hash
+* of the expression of a node. Identical expressions have the same hash in
+* every DAG, so a different hash means a different expression.
+* @param node is a node of this DAG.
+* @return size_t is the hash of the expression.
+* @throw node is not a node of this DAG.
+*/
+template<typename DataType>
+size_t ExprDag<DataType>::getHash(int node) const throw (logic_error)
+{
+    checkNode(node);
+    return nodes[node].hash;
+}
+
+/** Returns the number of nodes
+* in the DAG, which is the number of distinct subexpressions.
+* @return int is the number of nodes.
+*/
+template<typename DataType>
+int ExprDag<DataType>::getSize() const
+{
+    return nodes.size();
+}
+
+/** Returns the number of nodes
+* the expression of a node has as a tree, in which nothing is shared. It may
+* be far larger than the DAG.
+* @param node is a node of this DAG.
+* @return double is the number of nodes of the tree.
+* @throw node is not a node of this DAG.
+*/
+template<typename DataType>
+double ExprDag<DataType>::getTreeSize(int node) const throw (logic_error)
+{
+    checkNode(node);
+    vector<double> sizes(node + 1);
+    for(int i = 0; i <= node; i++)
+    {
+        sizes[i] = 1;
+        if(nodes[i].left >= 0)
+            sizes[i] += sizes[nodes[i].left] + sizes[nodes[i].right];
+    }
+    return sizes[node];
+}
+
+/** Returns the number of variables
+* in the DAG.
+* @return int is one more than the highest variable index.
+*/
+template<typename DataType>
+int ExprDag<DataType>::getNumVariables() const
+{
+    return variableNames.getCount();
+}
+
+/** Returns the index
+* of the variable called name, which is its position in the values passed to
+* evaluate().
+* @param name is the name of the variable.
+* @return int is the index of the variable, or -1 if the DAG has no such
+* variable.
+*/
+template<typename DataType>
+int ExprDag<DataType>::getVariableIndex(const string& name) const
+{
+    return variableNames.getIndex(name);
+}
+
+/** Returns the name
+* of the variable with the given index.
+* @param index is the index of the variable.
+* @return string is the name of the variable.
+* @throw There is no variable with that index.
+*/
+template<typename DataType>
+string ExprDag<DataType>::getVariableName(int index) const
+    throw (logic_error)
+{
+    return variableNames.getName(index);
+}
+
+/** Outputs the nodes
+* one per line, each operator with the nodes of its operands. If the DAG is
+* empty, it outputs "Empty DAG". This function is for testing purposes only.
+* @post The nodes will be outputed to the console.
+*/
+template<typename DataType>
+void ExprDag<DataType>::showStructure() const
+{
+    if(nodes.empty())
+    {
+        cout << "Empty DAG" << endl;
+        return;
+    }
+
+    for(size_t i = 0; i < nodes.size(); i++)
+    {
+        const Node& p = nodes[i];
+        cout << i << "\t";
+        if(p.dataItem == NUMBER)
+            cout << p.value;
+        else if(p.dataItem == VARIABLE)
+            cout << variableNames[p.variable];
+        else
+            cout << p.dataItem << " " << p.left << " " << p.right;
+        cout << endl;
+    }
+    cout << "(" << nodes.size() << " nodes, " << variableNames.getCount()
+        << " variables)" << endl;
+}
+
+/** Returns the node
+* that is the same as node, adding node to the DAG if there is none.
+* @param node is the node to find. Its children are already in the DAG.
+* @return int is the node in the DAG.
+*/
+template<typename DataType>
+int ExprDag<DataType>::insert(const Node& node)
+{
+    //Keep the table at most half full
+    if(2 * (nodes.size() + 1) > table.size())
+        growTable();
+
+    size_t mask = table.size() - 1;
+    size_t slot = (node.hash ^ (node.hash >> 16)) & mask;
+    while(table[slot] != -1)
+    {
+        if(isSameNode(nodes[table[slot]], node))
+            return table[slot];
+        slot = (slot + 1) & mask;
+    }
+    table[slot] = nodes.size();
+    nodes.push_back(node);
+    return table[slot];
+}
+
+/** Returns true if two nodes
+* hold the same data item and the same children. Otherwise, returns false.
+* @param first is a node.
+* @param second is a node.
+* @return The nodes are the same or not.
+*/
+template<typename DataType>
+bool ExprDag<DataType>::isSameNode(const Node& first,
+    const Node& second) const
+{
+    if(first.hash != second.hash || first.dataItem != second.dataItem)
+        return false;
+    if(first.dataItem == NUMBER)
+        return memcmp(&first.value, &second.value, sizeof(DataType)) == 0;
+    if(first.dataItem == VARIABLE)
+        return (first.variable == second.variable);
+    return (first.left == second.left && first.right == second.right);
+}
+
+/** Returns the hash
+* of the bits of a constant, so that constants with the same bits, and only
+* those, are sure to have the same hash.
+* @param value is the value of the constant.
+* @return size_t is the hash.
+*/
+template<typename DataType>
+size_t ExprDag<DataType>::valueHash(const DataType& value)
+{
+    const unsigned char *bytes = (const unsigned char*)&value;
+    size_t hash = 0;
+    for(size_t i = 0; i < sizeof(DataType); i++)
+        hash = combineExprHash(hash, bytes[i]);
+    return hash;
+}
+
+/** Doubles the size
+* of the table and puts every node back into it.
+*/
+template<typename DataType>
+void ExprDag<DataType>::growTable()
+{
+    table.assign(2 * table.size(), -1);
+    size_t mask = table.size() - 1;
+    for(size_t i = 0; i < nodes.size(); i++)
+    {
+        size_t slot = (nodes[i].hash ^ (nodes[i].hash >> 16)) & mask;
+        while(table[slot] != -1)
+            slot = (slot + 1) & mask;
+        table[slot] = i;
+    }
+}
+
+/** Throws logic_error
+* if node is not a node of this DAG.
+* @param node is the node to check.
+* @throw node is out of range.
+*/
+template<typename DataType>
+void ExprDag<DataType>::checkNode(int node) const throw (logic_error)
+{
+    if(node < 0 || node >= int(nodes.size()))
+        throw logic_error("not a node of the ExprDag");
+}
@@ -0,0 +1,82 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                            ExprDag.h
+//
+//  Class declarations for a hash-consed expression DAG: arithmetic
+//  expressions whose identical subexpressions are stored once
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPRDAG_H
+#define EXPRDAG_H
+
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "ExprOperator.h"
+#include "ExprHash.h"
+#include "ExprVariables.h"
+
+using namespace std;
+
+template <typename DataType>
+class ExprDag {
+  public:
+
+    // Constructor
+    ExprDag ();
+
+    // Node construction -- each returns the node, shared if it exists
+    int makeConstant(const DataType& value);
+    int makeVariable(const string& name);
+    int makeOperator(char op, int left, int right) throw (logic_error);
+    void clear ();
+
+    // Evaluation -- every shared node is evaluated once
+    DataType evaluate(int node, const DataType variables[] = NULL) const
+        throw (logic_error);
+    void evaluateAll(const DataType variables[], DataType values[]) const
+        throw (logic_error);
+
+    // Node status operations
+    bool isIdentical(int first, int second) const;  // Same expression
+    size_t getHash(int node) const throw (logic_error);
+    int getSize () const;                           // Distinct nodes
+    double getTreeSize(int node) const throw (logic_error);
+
+    // Variables, numbered in order of first appearance
+    int getNumVariables () const;
+    int getVariableIndex (const string& name) const;    // -1 if absent
+    string getVariableName (int index) const throw (logic_error);
+
+    // Output the nodes -- used in testing/debugging
+    void showStructure () const;
+
+  private:
+
+    struct Node {
+        char dataItem;          // Operator, NUMBER or VARIABLE
+        int left, right;        // Children, or -1 for a leaf
+        DataType value;         // Value of a NUMBER
+        int variable;           // Index of a VARIABLE
+        size_t hash;            // Hash of the whole subexpression
+    };
+
+    // Data items of the leaves
+    static const char NUMBER = '#';
+    static const char VARIABLE = '$';
+
+    int insert(const Node& node);
+    bool isSameNode(const Node& first, const Node& second) const;
+    void growTable ();
+    void checkNode(int node) const throw (logic_error);
+    static size_t valueHash(const DataType& value);
+
+    // Data members
+    vector<Node> nodes;         // Every child comes before its parents
+    vector<int> table;          // Nodes by hash, -1 where empty
+    ExprVariables variableNames;    // Names by index, indexes by name
+};
+
+#endif		// #ifndef EXPRDAG_H
@@ -0,0 +1,23 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                            ExprHash.h
+//
+//  The hash combiner shared by ExprTree and ExprDag, so that both
+//  hash the subexpressions of an expression the same way
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPRHASH_H
+#define EXPRHASH_H
+
+#include <cstddef>
+
+// Returns hash combined with value. The result depends on the order
+// values are combined in, so the operands of an operator are told
+// apart.
+inline size_t combineExprHash(size_t hash, size_t value)
+{
+    return hash ^ (value + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+}
+
+#endif		// #ifndef EXPRHASH_H
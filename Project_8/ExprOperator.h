@@ -0,0 +1,58 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                       ExprOperator.h
+//
+//  The arithmetic operators of an expression, shared by ExprTree,
+//  ExprProgram, ExprDag and the expression templates, so that every
+//  way of evaluating an expression gives the same value
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPROPERATOR_H
+#define EXPROPERATOR_H
+
+// Each operator applies itself to two values of any DataType
+
+struct ExprAdd {
+    static const char SYMBOL = '+';
+    template <typename DataType>
+    static DataType apply(const DataType& left, const DataType& right)
+        { return left + right; }
+};
+
+struct ExprSubtract {
+    static const char SYMBOL = '-';
+    template <typename DataType>
+    static DataType apply(const DataType& left, const DataType& right)
+        { return left - right; }
+};
+
+struct ExprMultiply {
+    static const char SYMBOL = '*';
+    template <typename DataType>
+    static DataType apply(const DataType& left, const DataType& right)
+        { return left * right; }
+};
+
+struct ExprDivide {
+    static const char SYMBOL = '/';
+    template <typename DataType>
+    static DataType apply(const DataType& left, const DataType& right)
+        { return left / right; }
+};
+
+// Applies the operator op, one of '+', '-', '*' and '/'
+template <typename DataType>
+inline DataType applyExprOperator(char op, const DataType& left,
+                                  const DataType& right)
+{
+    switch(op)
+    {
+        case '+': return ExprAdd::apply(left, right);
+        case '-': return ExprSubtract::apply(left, right);
+        case '*': return ExprMultiply::apply(left, right);
+        default:  return ExprDivide::apply(left, right);
+    }
+}
+
+#endif		// #ifndef EXPROPERATOR_H
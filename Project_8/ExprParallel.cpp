@@ -0,0 +1,126 @@
+/** @file ExprParallel.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will evaluate an expression tree on the threads of a
+* TaskPool.
+* @details The two operands of an operator can be evaluated at the same time.
+* Every node of an ExprTree holds the size of its subtree, so an ExprParallel
+* gives a task of its own only to operands of at least getCutoff() nodes, and
+* evaluates smaller subtrees as ExprTree::evaluate() does. Every operator is
+* applied to the same operands as in evaluate(), so the value is the same.
+* \n Only programs that use an ExprParallel depend on the TaskPool of Project 7,
+* and they must be built with -pthread.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "ExprParallel.h"
+#include "../Project_7/TaskPool.cpp"     // Build with -pthread
+using namespace std;
+
+//
+// ExprParallel Function Implementations ///////////////////////////////////////
+//
+
+/** The constructor
+* that evaluates on taskPool.
+* @param taskPool runs the tasks.
+* @param minTaskSize is the size of the smallest subtree given a task of its
+* own. It is at least 2, since a leaf is never worth a task.
+*/
+template<typename DataType>
+ExprParallel<DataType>::ExprParallel(TaskPool& taskPool, int minTaskSize)
+    : pool(taskPool)
+{
+    //A leaf is never large, so every large subtree is an operator
+    cutoff = (minTaskSize < 2) ? 2 : minTaskSize;
+}
+
+/** Returns the value
+* of the arithmetic expression of tree, evaluating its large subtrees at the
+* same time on the threads of the pool.
+* @pre tree is not empty.
+* @param tree is the expression tree.
+* @param variables holds the values of the variables in the order of their
+* indexes. It may be NULL if the expression has no variables.
+* @return The value of the arithmetic expression.
+* @throw tree is empty, or it has variables and none are given.
+* @see evalHelper()
+*/
+template<typename DataType>
+DataType ExprParallel<DataType>::evaluate(const ExprTree<DataType>& tree,
+    const DataType variables[]) const throw (logic_error)
+{
+    if(tree.root == NULL)
+        throw logic_error("ExprTree is empty.");
+    //Tasks must not throw, so check the variables before any start
+    if(variables == NULL && tree.variableNames.getCount() != 0)
+        throw logic_error("evaluate() without the values of the variables");
+    return evalHelper(tree, tree.root, variables);
+}
+
+/** Returns the size
+* of the smallest subtree given a task of its own.
+* @return int is the number of nodes.
+*/
+template<typename DataType>
+int ExprParallel<DataType>::getCutoff() const
+{
+    return cutoff;
+}
+
+/** Helper function for evaluate().
+* An operator whose operands both have at least cutoff nodes evaluates its
+* left operand in a task and its right operand itself. An operator with one
+* small operand has nothing to share, so the large operands are followed down
+* a chain without recursing until a subtree is small or has two large
+* operands. The chain is then applied back up with the small operands.
+* @param tree is the expression tree.
+* @param p is the root of the subtree.
+* @return The value of the subtree.
+* @see evaluate()
+*/
+template<typename DataType>
+DataType ExprParallel<DataType>::evalHelper(const ExprTree<DataType>& tree,
+    ExprTreeNode *p, const DataType variables[]) const
+{
+    //Follow the large operand of operators with one small operand
+    vector<ExprTreeNode*> chain;
+    while(p->size >= cutoff && (p->left->size < cutoff ||
+        p->right->size < cutoff))
+    {
+        chain.push_back(p);
+        p = (p->left->size < cutoff) ? p->right : p->left;
+    }
+
+    DataType value;
+    if(p->size < cutoff)
+        value = tree.evalHelper(p, variables);
+    else
+    {
+        DataType left;
+        TaskGroup group(pool);
+        group.run([this, &tree, p, variables, &left]()
+            { left = evalHelper(tree, p->left, variables); });
+        DataType right = evalHelper(tree, p->right, variables);
+        group.wait();
+        value = applyExprOperator(p->dataItem, left, right);
+    }
+
+    //Apply the chain, the deepest operator first
+    while(!chain.empty())
+    {
+        ExprTreeNode *q = chain.back();
+        chain.pop_back();
+        if(q->right == p)
+            value = applyExprOperator(q->dataItem,
+                tree.evalHelper(q->left, variables), value);
+        else
+            value = applyExprOperator(q->dataItem, value,
+                tree.evalHelper(q->right, variables));
+        p = q;
+    }
+    return value;
+}
@@ -0,0 +1,50 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                       ExprParallel.h
+//
+//  Class declarations for evaluating an expression tree with its
+//  large subtrees evaluated at the same time on a thread pool
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPRPARALLEL_H
+#define EXPRPARALLEL_H
+
+#include <stdexcept>
+#include <vector>
+#include "ExpressionTree.h"
+#include "../Project_7/TaskPool.h"
+
+using namespace std;
+
+template <typename DataType>
+class ExprParallel {
+  public:
+
+    // Subtrees smaller than this are not worth a task of their own
+    enum { DEFAULT_CUTOFF = 4096 };
+
+    // Constructor
+    ExprParallel (TaskPool& taskPool = TaskPool::getShared(),
+                  int minTaskSize = DEFAULT_CUTOFF);
+
+    // Evaluation -- the value is the same as that of tree.evaluate()
+    DataType evaluate(const ExprTree<DataType>& tree,
+                      const DataType variables[] = NULL) const
+        throw (logic_error);
+
+    int getCutoff () const;     // Nodes in the smallest task
+
+  private:
+
+    typedef typename ExprTree<DataType>::ExprTreeNode ExprTreeNode;
+
+    DataType evalHelper(const ExprTree<DataType>& tree, ExprTreeNode *p,
+                        const DataType variables[]) const;
+
+    // Data members
+    TaskPool& pool;             // Runs the tasks
+    int cutoff;                 // Size of the smallest subtree given a task
+};
+
+#endif		// #ifndef EXPRPARALLEL_H
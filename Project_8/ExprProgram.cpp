@@ -0,0 +1,468 @@
+/** @file ExprProgram.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will implement a compiled arithmetic expression that is
+* evaluated by a loop over an array of postfix instructions.
+* @details ExprTree::evaluate() follows a pointer to every node and decides
+* what the node is from its character each time it is called. An ExprProgram
+* holds the same expression as a contiguous array of instructions in postfix
+* order, built once by ExprTree::compile(). Evaluation is a single loop that
+* pushes operands on a small stack of values and replaces the top two values
+* by the result of every operator.
+* \n An operator whose right operand is a constant or a variable is fused
+* with it into one instruction, since that operand would be popped again by
+* the very next instruction. This removes about half of the instructions of a
+* balanced tree. Every instruction says where its operand comes from apart
+* from what it does, so the loop picks the operand without a branch and only
+* switches over the five operations. A switch over every combination is
+* mispredicted far more often on irregular expressions.
+* \n Variables are numbered from zero and bound when the program is evaluated.
+* evaluateBatch() evaluates the program once for every row of an array of
+* variable values, reusing one stack for the whole batch.
+* \n evaluateColumns() takes the values of every variable as a column instead,
+* and runs every instruction over a block of rows at once. The stack then holds
+* a column of the block for every value, and every operator is a loop over two
+* columns that the compiler vectorizes into SIMD instructions (with -O3, or -O2
+* -ftree-vectorize). The work of decoding an instruction is shared by the whole
+* block, and a block is small enough for its stack to stay in the cache.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "ExprProgram.h"
+#include <algorithm>
+using namespace std;
+
+//
+// ExprProgram Implementations /////////////////////////////////////////////////
+//
+
+/** The default constructor
+* that creates an empty program.
+* @post This program will be a valid empty program.
+*/
+template<typename DataType>
+ExprProgram<DataType>::ExprProgram()
+{
+    clear();
+}
+
+/** Appends a constant operand
+* to the end of the program.
+* @param value is the value of the operand.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::appendConstant(const DataType& value)
+{
+    Instruction instruction = { PUSH, CONSTANT, int(constants.size()) };
+    instructions.push_back(instruction);
+    constants.push_back(value);
+    if(++depth > maxDepth)
+        maxDepth = depth;
+}
+
+/** Appends a variable operand
+* to the end of the program. Its value is taken from the variables passed to
+* evaluate().
+* @param index is the number of the variable, from zero.
+* @throw The index is negative.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::appendVariable(int index) throw (logic_error)
+{
+    if(index < 0)
+        throw logic_error("appendVariable() with a negative index");
+
+    Instruction instruction = { PUSH, VARIABLE, index };
+    instructions.push_back(instruction);
+    if(index >= numVariables)
+        numVariables = index + 1;
+    if(++depth > maxDepth)
+        maxDepth = depth;
+}
+
+/** Appends an operator
+* that replaces the two values on top of the stack by its result. If the right
+* operand is the constant or variable just appended, the two are fused into one
+* instruction.
+* @param op is one of '+', '-', '*' and '/'.
+* @throw The operator is unknown, or there are fewer than two operands.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::appendOperator(char op) throw (logic_error)
+{
+    unsigned char opcode;
+    switch(op)
+    {
+        case '+': opcode = ADD; break;
+        case '-': opcode = SUBTRACT; break;
+        case '*': opcode = MULTIPLY; break;
+        case '/': opcode = DIVIDE; break;
+        default:
+            throw logic_error("appendOperator() with an unknown operator");
+    }
+    if(depth < 2)
+        throw logic_error("appendOperator() without two operands");
+
+    //The right operand was just pushed by a PUSH or left by an operator
+    Instruction& last = instructions.back();
+    if(last.opcode == PUSH)
+        last.opcode = opcode;
+    else
+    {
+        Instruction instruction = { opcode, STACK, 0 };
+        instructions.push_back(instruction);
+    }
+    depth--;
+}
+
+/** Removes all the instructions
+* from the program.
+* @post This program will be empty.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::clear()
+{
+    instructions.clear();
+    constants.clear();
+    numVariables = 0;
+    depth = 0;
+    maxDepth = 0;
+}
+
+/** Returns the value
+* of the program with the given values of its variables.
+* @pre The program is a complete expression.
+* @param variables holds the value of every variable by index. It may be NULL
+* if the program has no variables.
+* @return The value of the expression.
+* @throw The program is not a complete expression, or it has variables and
+* none are given.
+*/
+template<typename DataType>
+DataType ExprProgram<DataType>::evaluate(const DataType variables[]) const
+    throw (logic_error)
+{
+    checkComplete();
+    if(numVariables > 0 && variables == NULL)
+        throw logic_error("evaluate() without the variables of the program");
+
+    //Shallow programs need no memory for their stack
+    const int LOCAL_DEPTH = 64;
+    if(maxDepth <= LOCAL_DEPTH)
+    {
+        DataType stack[LOCAL_DEPTH];
+        return run(variables, stack);
+    }
+    vector<DataType> stack(maxDepth);
+    return run(variables, &stack[0]);
+}
+
+/** Evaluates the program
+* once for every row of variables.
+* @pre The program is a complete expression.
+* @param variables holds count rows of getNumVariables() values, one after the
+* other. It may be NULL if the program has no variables.
+* @param count is the number of rows.
+* @param results receives the value of the expression for every row.
+* @throw The program is not a complete expression, or it has variables and
+* none are given.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::evaluateBatch(const DataType variables[],
+    int count, DataType results[]) const throw (logic_error)
+{
+    checkComplete();
+    if(numVariables > 0 && variables == NULL && count > 0)
+        throw logic_error("evaluateBatch() without the variables of the "
+            "program");
+
+    vector<DataType> stack(maxDepth);
+    for(int i = 0; i < count; i++)
+    {
+        results[i] = run(variables, &stack[0]);
+        if(variables != NULL)
+            variables += numVariables;
+    }
+}
+
+/** Evaluates the program
+* once for every row of a table of variables stored by column.
+* @pre The program is a complete expression.
+* @param variables holds getNumVariables() columns, each with count values of
+* one variable. It may be NULL if the program has no variables.
+* @param count is the number of rows.
+* @param results receives the value of the expression for every row.
+* @throw The program is not a complete expression, or it has variables and
+* none are given.
+* @see runColumns()
+*/
+template<typename DataType>
+void ExprProgram<DataType>::evaluateColumns(
+    const DataType* const variables[], int count, DataType results[]) const
+    throw (logic_error)
+{
+    checkComplete();
+    if(numVariables > 0 && variables == NULL && count > 0)
+        throw logic_error("evaluateColumns() without the variables of the "
+            "program");
+
+    //A column of the block for every value on the stack
+    vector<DataType> stack(maxDepth * BLOCK_SIZE);
+    for(int first = 0; first < count; first += BLOCK_SIZE)
+    {
+        int rows = min(int(BLOCK_SIZE), count - first);
+        runColumns(variables, first, rows, &stack[0]);
+        copy(stack.begin(), stack.begin() + rows, results + first);
+    }
+}
+
+/** Throws logic_error
+* if the program does not leave exactly one value on the stack.
+* @throw The program is not a complete expression.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::checkComplete() const throw (logic_error)
+{
+    if(instructions.empty())
+        throw logic_error("ExprProgram is empty");
+    if(depth != 1)
+        throw logic_error("ExprProgram is not a complete expression");
+}
+
+/** Runs the instructions
+* and returns the value left on the stack.
+* @param variables holds the value of every variable by index.
+* @param stack has room for getMaxDepth() values.
+* @return The value of the expression.
+*/
+template<typename DataType>
+DataType ExprProgram<DataType>::run(const DataType variables[],
+    DataType stack[]) const
+{
+    const Instruction* instruction = &instructions[0];
+    const Instruction* end = instruction + instructions.size();
+    const DataType* sources[] = { constants.data(), variables };
+    DataType* top = stack;      //Just above the value on top of the stack
+
+    for(; instruction != end; instruction++)
+    {
+        //Find the operand, popping it if it is on the stack
+        const DataType* operand;
+        if(instruction->source == STACK)
+            operand = --top;
+        else
+            operand = sources[instruction->source] + instruction->operand;
+
+        switch(instruction->opcode)
+        {
+            case PUSH:
+                *top++ = *operand;
+                break;
+            case ADD:
+                top[-1] = ExprAdd::apply(top[-1], *operand);
+                break;
+            case SUBTRACT:
+                top[-1] = ExprSubtract::apply(top[-1], *operand);
+                break;
+            case MULTIPLY:
+                top[-1] = ExprMultiply::apply(top[-1], *operand);
+                break;
+            case DIVIDE:
+                top[-1] = ExprDivide::apply(top[-1], *operand);
+                break;
+        }
+    }
+    return top[-1];
+}
+
+/** Runs the instructions
+* over a block of rows, leaving the values of the expression in the first
+* column of the stack.
+* @param variables holds the column of every variable by index.
+* @param first is the row the block starts at.
+* @param count is the number of rows in the block, at most BLOCK_SIZE.
+* @param stack has room for getMaxDepth() columns of BLOCK_SIZE values.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::runColumns(const DataType* const variables[],
+    int first, int count, DataType stack[]) const
+{
+    const Instruction* instruction = &instructions[0];
+    const Instruction* end = instruction + instructions.size();
+    DataType* top = stack;      //Just above the column on top of the stack
+
+    for(; instruction != end; instruction++)
+    {
+        //A constant operand is one value for the whole block
+        if(instruction->source == CONSTANT)
+        {
+            const DataType& value = constants[instruction->operand];
+            if(instruction->opcode == PUSH)
+            {
+                fill(top, top + count, value);
+                top += BLOCK_SIZE;
+            }
+            else
+                applyScalar(instruction->opcode, top - BLOCK_SIZE, value,
+                    count);
+            continue;
+        }
+
+        //Find the operand column, popping it if it is on the stack
+        const DataType* operand;
+        if(instruction->source == STACK)
+        {
+            top -= BLOCK_SIZE;
+            operand = top;
+        }
+        else
+            operand = variables[instruction->operand] + first;
+
+        if(instruction->opcode == PUSH)
+        {
+            copy(operand, operand + count, top);
+            top += BLOCK_SIZE;
+        }
+        else
+            applyColumn(instruction->opcode, top - BLOCK_SIZE, operand,
+                count);
+    }
+}
+
+/** Combines two columns
+* by an operator, element by element. The operator is chosen once for the
+* column, so the loop has no branch and is vectorized.
+* @param opcode is ADD, SUBTRACT, MULTIPLY or DIVIDE.
+* @param left holds the left operands and receives the results.
+* @param right holds the right operands. It does not overlap left.
+* @param count is the number of values in the columns.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::applyColumn(unsigned char opcode,
+    DataType* __restrict__ left, const DataType* __restrict__ right,
+    int count)
+{
+    switch(opcode)
+    {
+        case ADD:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprAdd::apply(left[i], right[i]);
+            break;
+        case SUBTRACT:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprSubtract::apply(left[i], right[i]);
+            break;
+        case MULTIPLY:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprMultiply::apply(left[i], right[i]);
+            break;
+        case DIVIDE:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprDivide::apply(left[i], right[i]);
+            break;
+    }
+}
+
+/** Combines a column
+* with one value by an operator, element by element.
+* @param opcode is ADD, SUBTRACT, MULTIPLY or DIVIDE.
+* @param left holds the left operands and receives the results.
+* @param right is the right operand of every element.
+* @param count is the number of values in the column.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::applyScalar(unsigned char opcode, DataType* left,
+    DataType right, int count)
+{
+    switch(opcode)
+    {
+        case ADD:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprAdd::apply(left[i], right);
+            break;
+        case SUBTRACT:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprSubtract::apply(left[i], right);
+            break;
+        case MULTIPLY:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprMultiply::apply(left[i], right);
+            break;
+        case DIVIDE:
+            for(int i = 0; i < count; i++)
+                left[i] = ExprDivide::apply(left[i], right);
+            break;
+    }
+}
+
+/** Returns true if the program is empty.
+* Otherwise, returns false.
+* @return The program is empty or not.
+*/
+template<typename DataType>
+bool ExprProgram<DataType>::isEmpty() const
+{
+    return instructions.empty();
+}
+
+/** Returns the number of instructions
+* in the program.
+* @return int is the number of instructions.
+*/
+template<typename DataType>
+int ExprProgram<DataType>::getLength() const
+{
+    return instructions.size();
+}
+
+/** Returns the number of variables
+* in every row of values passed to evaluate() and evaluateBatch().
+* @return int is one more than the highest variable index.
+*/
+template<typename DataType>
+int ExprProgram<DataType>::getNumVariables() const
+{
+    return numVariables;
+}
+
+/** Returns the most values
+* on the stack at once while the program runs.
+* @return int is the depth of the stack.
+*/
+template<typename DataType>
+int ExprProgram<DataType>::getMaxDepth() const
+{
+    return maxDepth;
+}
+
+/** Outputs the instructions
+* one per line. If the program is empty, it outputs "Empty program". This
+* function is for testing purposes only.
+* @post The instructions will be outputed to the console.
+*/
+template<typename DataType>
+void ExprProgram<DataType>::showStructure() const
+{
+    if(instructions.empty())
+    {
+        cout << "Empty program" << endl;
+        return;
+    }
+
+    const char* names[] = { "push", "add", "sub", "mul", "div" };
+    for(size_t i = 0; i < instructions.size(); i++)
+    {
+        const Instruction& instruction = instructions[i];
+        cout << i << "\t" << names[instruction.opcode];
+        if(instruction.source == CONSTANT)
+            cout << " " << constants[instruction.operand];
+        else if(instruction.source == VARIABLE)
+            cout << " $" << instruction.operand;
+        cout << endl;
+    }
+    cout << "(" << numVariables << " variables, stack depth " << maxDepth
+        << ")" << endl;
+}
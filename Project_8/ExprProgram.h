@@ -0,0 +1,85 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                        ExprProgram.h
+//
+//  Class declarations for a compiled arithmetic expression: the
+//  postfix instructions of an expression tree in one array
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPRPROGRAM_H
+#define EXPRPROGRAM_H
+
+#include <stdexcept>
+#include <iostream>
+#include <vector>
+#include "ExprOperator.h"
+
+using namespace std;
+
+template <typename DataType>
+class ExprProgram {
+  public:
+
+    // Constructor
+    ExprProgram ();
+
+    // Program construction -- operands and operators in postfix order
+    void appendConstant(const DataType& value);
+    void appendVariable(int index) throw (logic_error);
+    void appendOperator(char op) throw (logic_error);
+    void clear ();
+
+    // Evaluation
+    DataType evaluate(const DataType variables[] = NULL) const
+        throw (logic_error);
+    void evaluateBatch(const DataType variables[], int count,
+                       DataType results[]) const throw (logic_error);
+    void evaluateColumns(const DataType* const variables[], int count,
+                         DataType results[]) const throw (logic_error);
+
+    // Program status operations
+    bool isEmpty () const;
+    int getLength () const;         // Number of instructions
+    int getNumVariables () const;   // Variables in every row of values
+    int getMaxDepth () const;       // Values on the stack at once
+
+    // Output the instructions -- used in testing/debugging
+    void showStructure () const;
+
+  private:
+
+    // Operations, and where their operand comes from. PUSH pushes the
+    // operand; an operator combines the value on top of the stack with
+    // its right operand, popped from the stack or read directly.
+    enum Opcode { PUSH, ADD, SUBTRACT, MULTIPLY, DIVIDE };
+    enum Source { CONSTANT, VARIABLE, STACK };
+
+    struct Instruction {
+        unsigned char opcode;       // Operation
+        unsigned char source;       // Where the operand comes from
+        int operand;                // Index of the constant or variable
+    };
+
+    // Rows evaluated at once by evaluateColumns()
+    enum { BLOCK_SIZE = 256 };
+
+    void checkComplete () const throw (logic_error);
+    DataType run(const DataType variables[], DataType stack[]) const;
+    void runColumns(const DataType* const variables[], int first, int count,
+                    DataType stack[]) const;
+    static void applyColumn(unsigned char opcode,
+                            DataType* __restrict__ left,
+                            const DataType* __restrict__ right, int count);
+    static void applyScalar(unsigned char opcode, DataType* left,
+                            DataType right, int count);
+
+    // Data members
+    vector<Instruction> instructions;
+    vector<DataType> constants;     // Values of the constant operands
+    int numVariables;               // One more than the highest index
+    int depth;                      // Values on the stack at the end
+    int maxDepth;                   // Most values on the stack at once
+};
+
+#endif		// #ifndef EXPRPROGRAM_H
@@ -0,0 +1,277 @@
+/** @file ExprScanner.cpp
+* @author Saharath Kleips
+* @version 1.00
+* @brief This program will split an arithmetic expression in prefix form into
+* its operators, numbers and variable names.
+* @details A token is one of the operators + - * /, a number such as 42, 3.5
+* or 1e-3, or a variable name made of letters, digits and underscores that
+* does not start with a digit. Whitespace separates tokens; an operator needs
+* none around it.
+* \n The scanner reads either a whole expression held in memory or an input
+* stream. In memory, a token is only a pointer into the text and its length,
+* so scanning does not allocate memory however long the expression is. From a
+* stream, characters are read one at a time and never beyond the end of the
+* expression, so the next expression can still be read from the same stream,
+* as the keyboard is. The token is then held in a buffer that is reused for
+* every token.
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "ExprScanner.h"
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+using namespace std;
+
+//
+// ExprScanner Implementations /////////////////////////////////////////////////
+//
+
+/** The parameterized constructor
+* that scans the expression read from input token by token.
+* @param input is the stream to read from. It must outlive the scanner.
+*/
+ExprScanner::ExprScanner(istream& input)
+{
+    this->input = &input;
+    current = end = NULL;
+    position = 0;
+    kind = END;
+    tokenStart = NULL;
+    tokenLength = 0;
+}
+
+/** The parameterized constructor
+* that scans the expression held in text.
+* @param text is the expression. It need not be null-terminated, and must
+* outlive the scanner.
+* @param length is the number of characters in text.
+*/
+ExprScanner::ExprScanner(const char* text, size_t length)
+{
+    input = NULL;
+    current = text;
+    end = text + length;
+    position = 0;
+    kind = END;
+    tokenStart = NULL;
+    tokenLength = 0;
+}
+
+/** Reads the next token.
+* @return The kind of the token, or END if only whitespace is left.
+* @throw A character cannot start a token, or a number is malformed.
+*/
+ExprScanner::Kind ExprScanner::next() throw (logic_error)
+{
+    //Skip the whitespace before the token
+    while(!atEnd() && isspace((unsigned char)peek()))
+        get();
+    tokenBuffer.clear();
+    tokenStart = current;
+
+    if(atEnd())
+        kind = END;
+    else if(isOperator(peek()))
+    {
+        get();
+        kind = OPERATOR;
+    }
+    else if(isDigit(peek()) || peek() == '.')
+    {
+        scanNumber();
+        kind = NUMBER;
+    }
+    else if(isNameStart(peek()))
+    {
+        scanName();
+        kind = NAME;
+    }
+    else
+        throw logic_error(string("unexpected character '") + peek() +
+            "' in expression");
+
+    if(input != NULL)
+    {
+        tokenStart = tokenBuffer.data();
+        tokenLength = tokenBuffer.length();
+    }
+    else
+        tokenLength = current - tokenStart;
+    return kind;
+}
+
+/** Returns the kind
+* of the current token.
+* @return Kind is the kind of the token read last.
+*/
+ExprScanner::Kind ExprScanner::getKind() const
+{
+    return kind;
+}
+
+/** Returns the text
+* of the current token. It is not null-terminated and only valid until the
+* next token is read.
+* @return const char* is the first character of the token.
+*/
+const char* ExprScanner::getText() const
+{
+    return tokenStart;
+}
+
+/** Returns the number of characters
+* in the current token.
+* @return size_t is the length of the token.
+*/
+size_t ExprScanner::getLength() const
+{
+    return tokenLength;
+}
+
+/** Returns the value
+* of the current token, which must be a NUMBER.
+* @return double is the value of the number.
+* @throw The number has more digits than can be converted.
+*/
+double ExprScanner::getNumber() const throw (logic_error)
+{
+    //Copy the token so strtod() stops at its end
+    char digits[64];
+    if(tokenLength >= sizeof(digits))
+        throw logic_error("number too long in expression");
+    memcpy(digits, tokenStart, tokenLength);
+    digits[tokenLength] = '\0';
+    return strtod(digits, NULL);
+}
+
+/** Returns the number of characters
+* read so far, including whitespace. Used in error messages.
+* @return long is the position after the current token.
+*/
+long ExprScanner::getPosition() const
+{
+    return position;
+}
+
+/** Returns true if there are no more characters.
+* Otherwise, returns false.
+* @return The expression has been read completely or not.
+*/
+bool ExprScanner::atEnd()
+{
+    if(input != NULL)
+        return (input->peek() == EOF);
+    return (current == end);
+}
+
+/** Returns the next character
+* without reading it.
+* @pre The scanner is not at the end.
+* @return char is the next character.
+*/
+char ExprScanner::peek()
+{
+    if(input != NULL)
+        return char(input->peek());
+    return *current;
+}
+
+/** Reads the next character
+* and adds it to the token buffer when reading from a stream.
+* @pre The scanner is not at the end.
+* @return char is the character read.
+*/
+char ExprScanner::get()
+{
+    position++;
+    if(input != NULL)
+    {
+        char c = char(input->get());
+        tokenBuffer += c;
+        return c;
+    }
+    return *current++;
+}
+
+/** Reads a number:
+* digits with an optional fraction and exponent.
+* @throw The number has no digits, or its exponent has none.
+*/
+void ExprScanner::scanNumber()
+{
+    int numDigits = 0;
+    while(!atEnd() && isDigit(peek()))
+    {
+        get();
+        numDigits++;
+    }
+    if(!atEnd() && peek() == '.')
+    {
+        get();
+        while(!atEnd() && isDigit(peek()))
+        {
+            get();
+            numDigits++;
+        }
+    }
+    if(numDigits == 0)
+        throw logic_error("number without digits in expression");
+
+    if(!atEnd() && (peek() == 'e' || peek() == 'E'))
+    {
+        get();
+        if(!atEnd() && (peek() == '+' || peek() == '-'))
+            get();
+        if(atEnd() || !isDigit(peek()))
+            throw logic_error("number without exponent digits in expression");
+        while(!atEnd() && isDigit(peek()))
+            get();
+    }
+    if(!atEnd() && isNamePart(peek()))
+        throw logic_error("number followed by a name in expression");
+}
+
+/** Reads a variable name.
+*/
+void ExprScanner::scanName()
+{
+    while(!atEnd() && isNamePart(peek()))
+        get();
+}
+
+/** Returns true if c
+* is one of the arithmetic operators. Otherwise, returns false.
+*/
+bool ExprScanner::isOperator(char c)
+{
+    return (c == '+' || c == '-' || c == '*' || c == '/');
+}
+
+/** Returns true if c
+* is a decimal digit. Otherwise, returns false.
+*/
+bool ExprScanner::isDigit(char c)
+{
+    return (c >= '0' && c <= '9');
+}
+
+/** Returns true if c
+* can start a variable name. Otherwise, returns false.
+*/
+bool ExprScanner::isNameStart(char c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_');
+}
+
+/** Returns true if c
+* can be part of a variable name. Otherwise, returns false.
+*/
+bool ExprScanner::isNamePart(char c)
+{
+    return (isNameStart(c) || isDigit(c));
+}
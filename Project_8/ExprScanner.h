@@ -0,0 +1,61 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                        ExprScanner.h
+//
+//  Class declarations for the scanner that splits an arithmetic
+//  expression into operators, numbers and variable names
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPRSCANNER_H
+#define EXPRSCANNER_H
+
+#include <stdexcept>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+class ExprScanner {
+  public:
+
+    // Kinds of tokens
+    enum Kind { END, OPERATOR, NUMBER, NAME };
+
+    // Constructors
+    ExprScanner(istream& input);                    // Token by token
+    ExprScanner(const char* text, size_t length);   // Whole buffer
+
+    // Scanning operations
+    Kind next () throw (logic_error);       // Reads the next token
+    Kind getKind () const;
+    const char* getText () const;           // Not null-terminated
+    size_t getLength () const;
+    double getNumber () const throw (logic_error);
+    long getPosition () const;              // Characters read so far
+
+  private:
+
+    bool atEnd ();
+    char peek ();
+    char get ();
+    void scanNumber ();
+    void scanName ();
+
+    static bool isOperator(char c);
+    static bool isDigit(char c);
+    static bool isNameStart(char c);
+    static bool isNamePart(char c);
+
+    // Data members
+    istream* input;             // Stream read, or NULL for a buffer
+    const char* current;        // Next character of the buffer
+    const char* end;            // End of the buffer
+    long position;              // Characters read so far
+    Kind kind;                  // Kind of the current token
+    const char* tokenStart;     // Text of the current token
+    size_t tokenLength;
+    string tokenBuffer;         // Holds the token read from a stream
+};
+
+#endif		// #ifndef EXPRSCANNER_H
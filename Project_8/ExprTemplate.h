@@ -0,0 +1,158 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                       ExprTemplate.h
+//
+//  Expression templates: an arithmetic expression written in C++
+//  whose type is its expression tree, so that the compiler turns its
+//  evaluation into straight-line code with no tree to walk
+//
+//  A formula such as
+//
+//      ExprVariable<0> x0;
+//      ExprVariable<1> x1;
+//      ... formula = (x0 + 2) * (x1 - 0.5);
+//
+//  has the type ExprApply<ExprMultiply, ExprApply<ExprAdd, ...>, ...>,
+//  and formula.evaluate(variables) is inlined into the arithmetic of
+//  the expression. The operators are those of ExprOperator.h, and
+//  numbers are converted to DataType from double as ExprTree
+//  converts the numbers it reads. The variable with index i is
+//  called xi in the prefix form. The ExprTree built from
+//  formula.prefix() numbers its variables by first appearance, so
+//  it gives the same value when the value of xi is passed at
+//  tree.getVariableIndex("xi"). A negative number is written as its
+//  difference from 0, and prefix() throws if a number is infinite
+//  or NaN.
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPRTEMPLATE_H
+#define EXPRTEMPLATE_H
+
+#include <stdexcept>
+#include <string>
+#include <sstream>
+#include <cmath>
+#include "ExprOperator.h"
+
+using namespace std;
+
+// Every expression derives from ExprTemplate<Expr>, so the operators
+// below only apply to expressions
+template <typename Expr>
+struct ExprTemplate {
+    const Expr& self () const
+        { return static_cast<const Expr&>(*this); }
+
+    // The expression in prefix form, as read by ExprTree::build()
+    string prefix () const throw (logic_error)
+    {
+        string text;
+        self().appendPrefix(text);
+        return text;
+    }
+};
+
+// A variable, whose value is given when the expression is evaluated
+template <int index>
+struct ExprVariable : public ExprTemplate< ExprVariable<index> > {
+    template <typename DataType>
+    DataType evaluate(const DataType variables[]) const
+        { return variables[index]; }
+
+    void appendPrefix(string& text) const
+    {
+        ostringstream name;
+        name << "x" << index << " ";
+        text += name.str();
+    }
+};
+
+// A number
+struct ExprNumber : public ExprTemplate<ExprNumber> {
+    explicit ExprNumber(double number) : value(number) {}
+
+    template <typename DataType>
+    DataType evaluate(const DataType /*variables*/[]) const
+        { return DataType(value); }
+
+    // ExprScanner reads a leading '-' as subtraction, so a negative
+    // number n is written - 0 -n, and -0 as * 0 - 0 1, which give the
+    // same bits. Infinities and NaN cannot be written at all.
+    void appendPrefix(string& text) const throw (logic_error)
+    {
+        if (!isfinite(value))
+            throw logic_error("prefix() of a number that is not finite");
+        ostringstream number;
+        number.precision(17);       // Enough digits to read back exactly
+        if (!signbit(value))
+            number << value << " ";
+        else if (value == 0)
+            number << "* 0 - 0 1 ";
+        else
+            number << "- 0 " << -value << " ";
+        text += number.str();
+    }
+
+    double value;
+};
+
+// An operator applied to two expressions. The operands are held by
+// value, since they are small and may be temporaries.
+template <typename Operator, typename Left, typename Right>
+struct ExprApply : public ExprTemplate< ExprApply<Operator, Left, Right> > {
+    ExprApply(const Left& leftOperand, const Right& rightOperand)
+        : left(leftOperand), right(rightOperand) {}
+
+    template <typename DataType>
+    DataType evaluate(const DataType variables[]) const
+    {
+        return Operator::apply(left.evaluate(variables),
+                               right.evaluate(variables));
+    }
+
+    void appendPrefix(string& text) const
+    {
+        text += Operator::SYMBOL;
+        text += ' ';
+        left.appendPrefix(text);
+        right.appendPrefix(text);
+    }
+
+    Left left;
+    Right right;
+};
+
+// The operators of two expressions, or of an expression and a number
+#define EXPR_TEMPLATE_OPERATOR(symbol, Operator)                        \
+    template <typename Left, typename Right>                            \
+    inline ExprApply<Operator, Left, Right>                             \
+    operator symbol(const ExprTemplate<Left>& left,                     \
+                    const ExprTemplate<Right>& right)                   \
+    {                                                                   \
+        return ExprApply<Operator, Left, Right>(left.self(),            \
+                                                right.self());          \
+    }                                                                   \
+    template <typename Left>                                            \
+    inline ExprApply<Operator, Left, ExprNumber>                        \
+    operator symbol(const ExprTemplate<Left>& left, double right)       \
+    {                                                                   \
+        return ExprApply<Operator, Left, ExprNumber>(left.self(),       \
+                                                     ExprNumber(right));\
+    }                                                                   \
+    template <typename Right>                                           \
+    inline ExprApply<Operator, ExprNumber, Right>                       \
+    operator symbol(double left, const ExprTemplate<Right>& right)      \
+    {                                                                   \
+        return ExprApply<Operator, ExprNumber, Right>(ExprNumber(left), \
+                                                      right.self());    \
+    }
+
+EXPR_TEMPLATE_OPERATOR(+, ExprAdd)
+EXPR_TEMPLATE_OPERATOR(-, ExprSubtract)
+EXPR_TEMPLATE_OPERATOR(*, ExprMultiply)
+EXPR_TEMPLATE_OPERATOR(/, ExprDivide)
+
+#undef EXPR_TEMPLATE_OPERATOR
+
+#endif		// #ifndef EXPRTEMPLATE_H
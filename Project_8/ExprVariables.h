@@ -0,0 +1,65 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                       ExprVariables.h
+//
+//  The variables of an expression, numbered in order of first
+//  appearance, shared by ExprTree and ExprDag
+//
+//--------------------------------------------------------------------
+
+#ifndef EXPRVARIABLES_H
+#define EXPRVARIABLES_H
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+class ExprVariables {
+  public:
+
+    // Returns the index of name, adding it with the next index if new
+    int add (const string& name)
+    {
+        unordered_map<string, int>::iterator found = indexes.find(name);
+        if(found != indexes.end())
+            return found->second;
+        int index = names.size();
+        names.push_back(name);
+        indexes[name] = index;
+        return index;
+    }
+
+    int getIndex (const string& name) const     // -1 if absent
+    {
+        unordered_map<string, int>::const_iterator found =
+            indexes.find(name);
+        return (found != indexes.end()) ? found->second : -1;
+    }
+
+    string getName (int index) const throw (logic_error)
+    {
+        if(index < 0 || index >= int(names.size()))
+            throw logic_error("getVariableName() with an invalid index");
+        return names[index];
+    }
+
+    const string& operator[] (int index) const  // Name of a valid index
+        { return names[index]; }
+
+    int getCount () const                       // Number of variables
+        { return names.size(); }
+
+    void clear ()
+        { names.clear(); indexes.clear(); }
+
+  private:
+
+    // Data members
+    vector<string> names;                       // Names by index
+    unordered_map<string, int> indexes;         // Indexes by name
+};
+
+#endif		// #ifndef EXPRVARIABLES_H
@@ -15,6 +15,19 @@
 * ( 1 + 3 ) * ( 6 - 4 )
 * \n Prefix notation is when each operator is placed immediately before its
 * operands: * + 1 3 - 6 4
+* \n A leaf is a number, such as 42 or 2.5e-3, or a named variable. Tokens are
+* separated by whitespace. The variables are numbered in the order they first
+* appear, and their values are passed to evaluate() in that order. build()
+* reads the expression from the keyboard, a stream or a buffer in memory; see
+* ExprScanner. compile() turns the tree into an ExprProgram, which evaluates
+* the same expression faster when it is evaluated many times. intern() adds
+* the tree to an ExprDag, which stores identical subexpressions once.
+* Every node holds the size of its subtree, so that an ExprParallel can tell
+* which subtrees are large enough to evaluate at the same time on a TaskPool.
+* \n The helper functions walk the tree with an explicit stack held in a
+* vector instead of recursing, so an expression thousands of operators deep
+* cannot overflow the call stack. They visit the nodes in the same order as
+* the recursive versions, so the results are the same.
 */
 
 //
@@ -22,7 +35,11 @@
 //
 
 #include "ExpressionTree.h"
-#include <ctype.h>
+#include "ExprProgram.cpp"
+#include "ExprDag.cpp"
+#include "ExprScanner.cpp"
+#include <cstring>
+#include <functional>
 using namespace std;
 
 //
@@ -50,6 +67,7 @@ ExprTree<DataType>::ExprTree()
 template<typename DataType>
 ExprTree<DataType>::ExprTree(const ExprTree& source)
 {
+    root = NULL;
     *this = source;
 }
 
@@ -69,11 +87,16 @@ ExprTree<DataType>& ExprTree<DataType>::operator=(const ExprTree<DataType>&
     if(this == &source)
         return *this;
 
+    clear();
     copyHelper(root, source.root);
+    variableNames = source.variableNames;
     return *this;
 }
 
-/** Recursive helper function for operator=().
+/** Helper function for operator=().
+* Copies the nodes in preorder: every node is allocated before its children.
+* The left branch is copied first, while the right subtrees wait on a stack
+* with the pointers they are to be copied into.
 * @post The nodes will be set equal to eachother.
 * @param dest is the node to copy the values to.
 * @param source is the node to copy the values from.
@@ -82,13 +105,27 @@ ExprTree<DataType>& ExprTree<DataType>::operator=(const ExprTree<DataType>&
 template<typename DataType>
 void ExprTree<DataType>::copyHelper(ExprTreeNode *&dest, ExprTreeNode *source)
 {
-    if(source != NULL)
+    //Right subtrees still to be copied, with the pointers to copy them into
+    vector< pair<ExprTreeNode**, ExprTreeNode*> > pending;
+    ExprTreeNode **target = &dest;
+    ExprTreeNode *node = source;
+    for(;;)
     {
-        ExprTreeNode *left = NULL;  //Store the possible left node
-        ExprTreeNode *right = NULL; //Store the possible right node
-        copyHelper(left, source->left); //Recursively call left
-        copyHelper(right, source->right);   //Recursively call right
-        dest = new ExprTreeNode(source->dataItem, left, right); //Copy the node
+        while(node != NULL)
+        {
+            *target = new ExprTreeNode(node->dataItem, node->value,
+                node->variable);    //Copy the node
+            (*target)->size = node->size;
+            if(node->right != NULL)
+                pending.push_back(make_pair(&(*target)->right, node->right));
+            target = &(*target)->left;
+            node = node->left;
+        }
+        if(pending.empty())
+            return;
+        target = pending.back().first;
+        node = pending.back().second;
+        pending.pop_back();
     }
 }
 
@@ -108,33 +145,184 @@ ExprTree<DataType>::~ExprTree()
 * @pre The expression from the keyboard must be a valid arithmetic expression.
 * @post This ExprTree will accurately represent the arithmetic expression
 * entered.
+* @throw The expression is malformed or ends early. The tree is then empty.
+* @see buildHelper()
+*/
+template<typename DataType>
+void ExprTree<DataType>::build() throw (logic_error)
+{
+    build(cin);
+}
+
+/** Reads an arithmetic expression in prefix form
+* from input and builds the corresponding expression tree. Reading stops at the
+* end of the expression, so input may hold more than one expression.
+* @post This ExprTree will accurately represent the arithmetic expression read.
+* @param input is the stream to read from.
+* @throw The expression is malformed or ends early. The tree is then empty.
+* @see buildHelper()
+*/
+template<typename DataType>
+void ExprTree<DataType>::build(istream& input) throw (logic_error)
+{
+    ExprScanner scanner(input);
+    clear();
+    try
+    {
+        buildHelper(root, scanner);
+        sizeHelper(root);
+    }
+    catch(logic_error&)
+    {
+        clear();
+        throw;
+    }
+}
+
+/** Builds the expression tree
+* of the arithmetic expression in prefix form held in text. This is the fastest
+* way to build a large tree, such as one read from a file.
+* @post This ExprTree will accurately represent the arithmetic expression.
+* @param text is the expression. It need not be null-terminated.
+* @param length is the number of characters in text.
+* @throw The expression is malformed, ends early or is followed by more text.
+* The tree is then empty.
 * @see buildHelper()
 */
 template<typename DataType>
-void ExprTree<DataType>::build()
+void ExprTree<DataType>::build(const char* text, size_t length)
+    throw (logic_error)
 {
-    buildHelper(root);
+    ExprScanner scanner(text, length);
+    clear();
+    try
+    {
+        buildHelper(root, scanner);
+        if(scanner.next() != ExprScanner::END)
+            throw logic_error("text after the end of the expression");
+        sizeHelper(root);
+    }
+    catch(logic_error&)
+    {
+        clear();
+        throw;
+    }
 }
 
-/** Recursive helper function for the build() function.
+/** Builds the expression tree
+* of the arithmetic expression in prefix form held in text.
+* @param text is the expression.
+* @throw The expression is malformed, ends early or is followed by more text.
+* The tree is then empty.
+* @see build(const char*, size_t)
+*/
+template<typename DataType>
+void ExprTree<DataType>::build(const string& text) throw (logic_error)
+{
+    build(text.data(), text.length());
+}
+
+/** Helper function for the build() functions.
 * It takes a reference to a pointer to an expression tree node so that if a new
 * node should be added to the tree, it can be allocated and added by assigning
-* the newly allocated node to the node parameter.
+* the newly allocated node to the node parameter. The pointers still waiting
+* for a node are kept on a stack, left above right, so the nodes are read in
+* prefix order. A variable seen for the first time gets the next index.
 * @parm node is the node to put data into.
+* @param scanner supplies the tokens of the expression.
+* @throw The expression is malformed or ends early.
 * @see build()
 */
 template<typename DataType>
-void ExprTree<DataType>::buildHelper(ExprTreeNode *&node)
+void ExprTree<DataType>::buildHelper(ExprTreeNode *&node, ExprScanner& scanner)
 {
-    char c;
-    cin >> c;
-    node = new ExprTreeNode(c, NULL, NULL); //The node is the character entered
+    vector<ExprTreeNode**> pending;  //Pointers still to be set
+    string name;                     //Reused for every variable name
+    pending.push_back(&node);
+    while(!pending.empty())
+    {
+        ExprTreeNode **target = pending.back();
+        pending.pop_back();
 
-    //If it's an operator, recursively call -- digits are leafs
-    if(c == '+' || c == '-' || c == '*' || c == '/')
+        switch(scanner.next())
+        {
+            case ExprScanner::END:
+                throw logic_error("expression ends before its last operand");
+            //If it's an operator, its operands come next
+            case ExprScanner::OPERATOR:
+                *target = new ExprTreeNode(scanner.getText()[0],
+                    (ExprTreeNode*)NULL, (ExprTreeNode*)NULL);
+                pending.push_back(&(*target)->right);
+                pending.push_back(&(*target)->left);
+                break;
+            //Numbers and variables are leafs
+            case ExprScanner::NUMBER:
+                *target = new ExprTreeNode(NUMBER,
+                    DataType(scanner.getNumber()), -1);
+                break;
+            case ExprScanner::NAME:
+            {
+                name.assign(scanner.getText(), scanner.getLength());
+                *target = new ExprTreeNode(VARIABLE, DataType(),
+                    variableNames.add(name));
+                break;
+            }
+        }
+    }
+}
+
+/** Helper function for the build() functions.
+* Sets the size of every operator once its operands are built. The operators
+* are visited in postorder, so the sizes of their operands are already set.
+* @param p is the root of the subtree.
+* @see build(), postorderHelper()
+*/
+template<typename DataType>
+void ExprTree<DataType>::sizeHelper(ExprTreeNode *p)
+{
+    postorderHelper(p, [](ExprTreeNode *&q)
     {
-        buildHelper(node->left);    //Recursively call left
-        buildHelper(node->right);   //Recursively call right
+        if(isOperator(q->dataItem))
+            q->size = 1 + q->left->size + q->right->size;
+    });
+}
+
+/** Visits every node
+* of a subtree in postorder, so the operands of an operator are visited before
+* it is. The stack holds the links to the operators whose operands are being
+* visited, and if their right operand is being visited. The walk of the
+* operations that take an expression apart: build(), compile(), intern(),
+* simplify() and the canonical form.
+* @param p is the link to the root of the subtree.
+* @param visit is called with the link to every node. It may replace the node,
+* since its operator is only visited afterwards.
+*/
+template<typename DataType>
+template<typename Visitor>
+void ExprTree<DataType>::postorderHelper(ExprTreeNode *&p, Visitor visit)
+{
+    vector< pair<ExprTreeNode**, bool> > pending;
+    ExprTreeNode **node = &p;
+    for(;;)
+    {
+        //Follow the left operands down to a leaf
+        while(isOperator((*node)->dataItem))
+        {
+            pending.push_back(make_pair(node, false));
+            node = &(*node)->left;
+        }
+        visit(*node);
+
+        //Operators follow both of their operands
+        while(!pending.empty() && pending.back().second)
+        {
+            visit(*pending.back().first);
+            pending.pop_back();
+        }
+        if(pending.empty())
+            return;
+        pending.back().second = true;
+        node = &(*pending.back().first)->right;
     }
 }
 
@@ -150,73 +338,259 @@ void ExprTree<DataType>::expression() const
     expressionHelper(root);
 }
 
-/** Recursive helper function for expression() function.
+/** Helper function for expression() function.
+* The stack holds the operators whose parenthesis is open, and if their right
+* operand is being output.
 * @see expression()
 */
 template<typename DataType>
 void ExprTree<DataType>::expressionHelper(ExprTreeNode *p) const
 {
-    //Base case, if it's a digit, simply print out the number
-    if(isdigit(p->dataItem))
+    vector< pair<ExprTreeNode*, bool> > pending;
+    for(;;)
     {
-        cout << p->dataItem;
-        return;
+        //Open the parenthesis down the left branch to a leaf
+        while(isOperator(p->dataItem))
+        {
+            cout << '(';
+            pending.push_back(make_pair(p, false));
+            p = p->left;
+        }
+        //It's a number or a variable, so simply print it out
+        showItem(p);
+
+        //Close the parenthesis of the operators that are done
+        while(!pending.empty() && pending.back().second)
+        {
+            cout << ')';
+            pending.pop_back();
+        }
+        if(pending.empty())
+            return;
+
+        //Output the operator, then its right operand
+        cout << pending.back().first->dataItem;
+        pending.back().second = true;
+        p = pending.back().first->right;
     }
-    //Build the parenthesis around the expression
-    cout << '(';
-    expressionHelper(p->left);  //Recursively call left
-    cout << p->dataItem;
-    expressionHelper(p->right); //Recursively call right
-    cout << ')';
 }
 
 /** Returns the value
 * of the corresponding arithmetic expression.
 * @pre This ExprTree is not empty.
+* @param variables holds the values of the variables in the order of their
+* indexes. It may be NULL if the expression has no variables.
 * @return The value of the arithmetic expression.
-* @throw The ExprTree is empty.
+* @throw The ExprTree is empty, or it has variables and none are given.
 * @see evalHelper()
 */
 template<typename DataType>
-DataType ExprTree<DataType>::evaluate() const throw (logic_error)
+DataType ExprTree<DataType>::evaluate(const DataType variables[]) const
+    throw (logic_error)
+{
+    if(root == NULL)
+        throw logic_error("ExprTree is empty.");
+    return evalHelper(root, variables);
+}
+
+/** Evaluates the expression
+* once for every row of a table of variables stored by column. The tree is
+* compiled, and the program evaluates whole blocks of rows at a time.
+* @pre This ExprTree is not empty.
+* @param variables holds getNumVariables() columns, each with count values of
+* one variable. It may be NULL if the expression has no variables.
+* @param count is the number of rows.
+* @param results receives the value of the expression for every row.
+* @throw The ExprTree is empty, or it has variables and none are given.
+* @see compile(), ExprProgram::evaluateColumns()
+*/
+template<typename DataType>
+void ExprTree<DataType>::evaluateColumns(const DataType* const variables[],
+    int count, DataType results[]) const throw (logic_error)
+{
+    ExprProgram<DataType> program;
+    compile(program);
+    program.evaluateColumns(variables, count, results);
+}
+
+/** Compiles the expression
+* into program, replacing what it held. The program evaluates to the same value
+* as evaluate(), with the same variable indexes.
+* @pre This ExprTree is not empty.
+* @post program holds the instructions of the expression in postfix order.
+* @param program is the program to compile into.
+* @throw The ExprTree is empty.
+* @see ExprProgram
+*/
+template<typename DataType>
+void ExprTree<DataType>::compile(ExprProgram<DataType>& program) const
+    throw (logic_error)
 {
     if(root == NULL)
-        throw("ExprTree is empty.");
-    return evalHelper(root);
+        throw logic_error("compile() on an empty ExprTree");
+
+    //Operators follow both of their operands
+    ExprTreeNode *p = root;
+    program.clear();
+    postorderHelper(p, [&program](ExprTreeNode *&q)
+    {
+        if(q->dataItem == VARIABLE)
+            program.appendVariable(q->variable);
+        else if(q->dataItem == NUMBER)
+            program.appendConstant(q->value);
+        else
+            program.appendOperator(q->dataItem);
+    });
 }
 
-/** Recursive helper function for evaluate() function.
+/** Adds the expression
+* to dag, sharing every subexpression dag already has, and returns its node.
+* Variables are matched by name.
+* @pre This ExprTree is not empty.
+* @param dag is the DAG to add the expression to.
+* @return int is the node of the expression in dag.
+* @throw The ExprTree is empty.
+* @see ExprDag
+*/
+template<typename DataType>
+int ExprTree<DataType>::intern(ExprDag<DataType>& dag) const
+    throw (logic_error)
+{
+    if(root == NULL)
+        throw logic_error("intern() on an empty ExprTree");
+
+    //The nodes of the variables in dag, by their index in this tree
+    vector<int> variableNodes(variableNames.getCount());
+    for(int i = 0; i < variableNames.getCount(); i++)
+        variableNodes[i] = dag.makeVariable(variableNames[i]);
+
+    //The nodes of the operands added so far; operators follow both of their
+    //operands
+    vector<int> operands;
+    ExprTreeNode *p = root;
+    postorderHelper(p, [&dag, &variableNodes, &operands](ExprTreeNode *&q)
+    {
+        if(q->dataItem == VARIABLE)
+            operands.push_back(variableNodes[q->variable]);
+        else if(q->dataItem == NUMBER)
+            operands.push_back(dag.makeConstant(q->value));
+        else
+        {
+            int right = operands.back();
+            operands.pop_back();
+            operands.back() = dag.makeOperator(q->dataItem, operands.back(),
+                right);
+        }
+    });
+    return operands.back();
+}
+
+/** Helper function for evaluate() function.
+* Evaluates the tree in postorder. The stack holds the operators whose operands
+* are being evaluated, with the value of the left operand once it is known. It
+* follows the left operands down to a leaf, then returns up the stack until an
+* operator still needs a right operand that is not a leaf. The first frames of
+* the stack are a local array, so shallow trees are evaluated without
+* allocating memory.
 * @see evaluate()
 */
 template<typename DataType>
-DataType ExprTree<DataType>::evalHelper(ExprTreeNode *p) const
+DataType ExprTree<DataType>::evalHelper(ExprTreeNode *p,
+    const DataType variables[]) const
 {
-    //Switch statement to determine the proper operator
-    switch(p->dataItem)
+    struct Frame
+    {
+        ExprTreeNode *node;     //Operator being evaluated
+        bool hasLeft;           //Left operand has been evaluated
+        DataType left;          //Value of the left operand
+    };
+
+    const size_t LOCAL_FRAMES = 64;
+    Frame localFrames[LOCAL_FRAMES];
+    vector<Frame> moreFrames;   //Frames once the local array is full
+    Frame *frames = localFrames;
+    size_t capacity = LOCAL_FRAMES;
+    size_t numFrames = 0;
+    DataType value;             //Value of the subtree evaluated last
+    for(;;)
     {
-        //Case is addition
-        case '+':
-            return (evalHelper(p->left) + evalHelper(p->right));
-            break;
-        //Case is subtraction
-        case '-':
-            return (evalHelper(p->left) - evalHelper(p->right));
-            break;
-        //Case is multiplication
-        case '*':
-            return (evalHelper(p->left) * evalHelper(p->right));
-            break;
-        //Case is division
-        case '/':
-            return (evalHelper(p->left) / evalHelper(p->right));
-            break;
-        //Case is a digit, so convert from char to int
-        default:
-            return (p->dataItem - '0');
-            break;
+        //Follow the left operands down to a leaf
+        while(isOperator(p->dataItem))
+        {
+            if(numFrames == capacity)
+            {
+                if(frames == localFrames)
+                    moreFrames.assign(localFrames, localFrames + numFrames);
+                moreFrames.resize(2 * capacity);
+                frames = &moreFrames[0];
+                capacity = moreFrames.size();
+            }
+            frames[numFrames].node = p;
+            frames[numFrames].hasLeft = false;
+            numFrames++;
+            p = p->left;
+        }
+        value = leafValue(p, variables);
+
+        //Apply the operators whose operands are known
+        for(;;)
+        {
+            if(numFrames == 0)
+                return value;
+            Frame& frame = frames[numFrames - 1];
+            if(frame.hasLeft)
+                value = applyExprOperator(frame.node->dataItem, frame.left,
+                    value);
+            else if(isOperator(frame.node->right->dataItem))
+            {
+                //Keep the left operand and evaluate the right one
+                frame.hasLeft = true;
+                frame.left = value;
+                p = frame.node->right;
+                break;
+            }
+            else
+                value = applyExprOperator(frame.node->dataItem, value,
+                    leafValue(frame.node->right, variables));
+            numFrames--;
+        }
     }
 }
 
+/** Returns true if dataItem
+* is one of the arithmetic operators. Otherwise, returns false.
+* @param dataItem is the data item of a node.
+* @return The data item is an operator or not.
+*/
+template<typename DataType>
+bool ExprTree<DataType>::isOperator(char dataItem)
+{
+    return (dataItem == '+' || dataItem == '-' || dataItem == '*' ||
+        dataItem == '/');
+}
+
+/** Returns the value
+* of the leaf p.
+* @param p is a NUMBER or VARIABLE node.
+* @param variables holds the values of the variables in the order of their
+* indexes.
+* @return The value of the number or variable.
+* @throw p is a variable and variables is NULL.
+*/
+template<typename DataType>
+DataType ExprTree<DataType>::leafValue(ExprTreeNode *p,
+    const DataType variables[]) throw (logic_error)
+{
+    if(p->dataItem == VARIABLE)
+    {
+        if(variables == NULL)
+            throw logic_error("evaluate() without the values of the "
+                "variables");
+        return variables[p->variable];
+    }
+    return p->value;
+}
+
 /** Removes all the data items
 * in the expression tree.
 * @post This ExprTree will be an empty, deallocated, ExprTree.
@@ -226,21 +600,33 @@ template<typename DataType>
 void ExprTree<DataType>::clear()
 {
     clearHelper(root);
+    variableNames.clear();
 }
 
-/** Recursive helper function for clear() function.
+/** Helper function for clear() function.
 * @see clear()
 */
 template<typename DataType>
 void ExprTree<DataType>::clearHelper(ExprTreeNode *&p)
 {
-    //Node is not null, so must be deleted
-    if(p != NULL)
+    vector<ExprTreeNode*> pending;  //Right subtrees still to be deleted
+    ExprTreeNode *node = p;
+    p = NULL;   //Set to null for dangling pointer
+    for(;;)
     {
-        clearHelper(p->left);   //Recursively call left
-        clearHelper(p->right);  //Recursively call right
-        delete p;   //Delete the node
-        p = NULL;   //Set to null for dangling pointer
+        //Delete down the left branch, leaving the right subtrees for later
+        while(node != NULL)
+        {
+            ExprTreeNode *left = node->left;
+            if(node->right != NULL)
+                pending.push_back(node->right);
+            delete node;    //Delete the node
+            node = left;
+        }
+        if(pending.empty())
+            return;
+        node = pending.back();
+        pending.pop_back();
     }
 }
 
@@ -255,85 +641,408 @@ void ExprTree<DataType>::commute()
     commuteHelper(root);
 }
 
-/** Recursive helper function for commute() function.
+/** Helper function for commute() function.
 * @see commute()
 */
 template<typename DataType>
 void ExprTree<DataType>::commuteHelper(ExprTreeNode *&p)
 {
-    //Base case, cannot commute if node is null
-    if(p == NULL)
+    vector<ExprTreeNode*> pending;  //Right subtrees still to be commuted
+    ExprTreeNode *node = p;
+    for(;;)
+    {
+        //Commute down the left branch, leaving the right subtrees for later
+        while(node != NULL)
+        {
+            //If the character is an operator, then switch the nodes
+            if(isOperator(node->dataItem))
+                commuteNode(node);
+            if(node->right != NULL)
+                pending.push_back(node->right);
+            node = node->left;
+        }
+        if(pending.empty())
+            return;
+        node = pending.back();
+        pending.pop_back();
+    }
+}
+
+/** Switches the operands
+* of the operator p.
+* @param p is an operator node.
+* @see commute()
+*/
+template<typename DataType>
+void ExprTree<DataType>::commuteNode(ExprTreeNode *p)
+{
+    ExprTreeNode* temp = p->left;
+    p->left = p->right;
+    p->right = temp;
+}
+
+/** Simplifies the expression
+* so that it evaluates to the same value with fewer nodes. An operator on two
+* numbers is replaced by its value, except division by zero. An operator whose
+* right operand is an identity is replaced by its left operand: x - 0, x * 1
+* and x / 1 are all x, but not x - -0. The operands of + and * are put in a
+* canonical order first: an operator before a variable before a number, and
+* variables by index. So numbers end up on the right, where they are folded,
+* and expressions that differ only in that order become identical.
+* \n None of these change the value, even of infinities, NaN and -0. That is
+* why x + 0 is kept: it turns -0 into 0, and 1 / (x + 0) into infinity instead
+* of minus infinity.
+* @post The ExprTree is simplified.
+* @see simplifyHelper()
+*/
+template<typename DataType>
+void ExprTree<DataType>::simplify()
+{
+    if(root != NULL)
+        simplifyHelper(root);
+}
+
+/** Helper function for simplify() function.
+* Simplifies the operators in postorder, so the operands of an operator are
+* simplified before it is.
+* @param p is the pointer to the root of the subtree. It is changed if the
+* root is replaced.
+* @see simplify(), postorderHelper()
+*/
+template<typename DataType>
+void ExprTree<DataType>::simplifyHelper(ExprTreeNode *&p)
+{
+    postorderHelper(p, [this](ExprTreeNode *&q)
+    {
+        if(isOperator(q->dataItem))
+            simplifyNode(q);
+    });
+}
+
+/** Simplifies the operator p
+* whose operands are already simplified.
+* @param p is the pointer to the operator. It is changed if the operator is
+* replaced.
+* @see simplify()
+*/
+template<typename DataType>
+void ExprTree<DataType>::simplifyNode(ExprTreeNode *&p)
+{
+    p->size = 1 + p->left->size + p->right->size;
+
+    //Put the operands of + and * in canonical order
+    if(p->dataItem == '+' || p->dataItem == '*')
+    {
+        int leftRank = operandRank(p->left);
+        int rightRank = operandRank(p->right);
+        if(leftRank > rightRank || (leftRank == rightRank &&
+            p->left->dataItem == VARIABLE &&
+            p->left->variable > p->right->variable))
+            commuteNode(p);
+    }
+
+    ExprTreeNode *left = p->left;
+    ExprTreeNode *right = p->right;
+    if(right->dataItem != NUMBER)
+        return;
+
+    //Fold an operator on two numbers into its value
+    if(left->dataItem == NUMBER)
+    {
+        if(p->dataItem == '/' && right->value == DataType(0))
+            return;
+        p->value = applyExprOperator(p->dataItem, left->value,
+            right->value);
+        p->dataItem = NUMBER;
+        p->size = 1;
+        p->left = p->right = NULL;
+        delete left;
+        delete right;
         return;
-    //If the character is an operator, then switch the nodes
-    if(!isdigit(p->dataItem))
+    }
+
+    //Replace x - 0, x * 1 and x / 1 by x. A folded 0 may be -0, and x - -0
+    //is x + 0, so the 0 must have the same bits as DataType(0)
+    const DataType ZERO = DataType(0);
+    bool isIdentity = (p->dataItem == '-' &&
+        memcmp(&right->value, &ZERO, sizeof(DataType)) == 0) ||
+        ((p->dataItem == '*' || p->dataItem == '/') &&
+        right->value == DataType(1));
+    if(isIdentity)
     {
-        ExprTreeNode* temp = p->left;
-        p->left = p->right;
-        p->right = temp;
+        delete right;
+        delete p;
+        p = left;
     }
-    commuteHelper(p->left);     //Recursively call left
-    commuteHelper(p->right);    //Recursively call right
+}
+
+/** Returns the rank
+* of an operand in the canonical order of the operands of + and *: 0 for an
+* operator, 1 for a variable and 2 for a number.
+* @param p is the operand.
+* @return int is the rank.
+*/
+template<typename DataType>
+int ExprTree<DataType>::operandRank(ExprTreeNode *p)
+{
+    if(p->dataItem == NUMBER)
+        return 2;
+    if(p->dataItem == VARIABLE)
+        return 1;
+    return 0;
+}
+
+/** Returns the number of nodes
+* in the expression tree.
+* @return int is the number of operators, numbers and variables.
+*/
+template<typename DataType>
+int ExprTree<DataType>::getSize() const
+{
+    return (root == NULL) ? 0 : root->size;
 }
 
 /** Compares the expression tree to another expression tree
-* for equivalence. If the two trees are equivalent, then returns true. Otherwise
-* returns false.
+* for equivalence. The trees are equivalent if they are the same once the
+* operands of some additions and multiplications are switched. If the two
+* trees are equivalent, then returns true. Otherwise returns false.
+* \n Both trees are put in canonical form, where the operands of + and * are
+* ordered by hash, so equivalent trees have the same canonical form. The
+* comparison then takes time linear in the size of the trees, where trying
+* both orders of every pair of operands could take exponential time.
 * @pre Both trees are valid expression trees
 * @param source is the ExprTree to compare to this ExprTree
 * @return True if the trees are equivalent. False if they are not equivalent.
-* @see isEquivHelper()
+* @see isEquivHelper(), canonicalForm()
 */
 template<typename DataType>
 bool ExprTree<DataType>::isEquivalent(const ExprTree& source) const
 {
-    return isEquivHelper(root, source.root);
+    vector<CanonicalNode> destForm, sourceForm;
+    canonicalForm(destForm);
+    source.canonicalForm(sourceForm);
+    return isEquivHelper(destForm, source, sourceForm);
+}
+
+/** Puts the expression tree
+* in canonical form: the operands of every + and * are ordered by the hash of
+* their canonical form. Equivalent trees have the same canonical form, and it
+* evaluates to the same value.
+* @post The operands of + and * are in canonical order.
+* @see canonicalForm()
+*/
+template<typename DataType>
+void ExprTree<DataType>::canonicalize()
+{
+    vector<CanonicalNode> form;
+    canonicalForm(form);
+    for(size_t i = 0; i < form.size(); i++)
+    {
+        if(form[i].isSwapped)
+            commuteNode(form[i].node);
+    }
+}
+
+/** Returns the hash
+* of the canonical form of the expression tree. Equivalent trees have the same
+* hash, so trees with different hashes are not equivalent. A set of trees can
+* be deduplicated by comparing only the trees with the same hash.
+* @return size_t is the hash, or 0 if the tree is empty.
+* @see canonicalForm()
+*/
+template<typename DataType>
+size_t ExprTree<DataType>::getCanonicalHash() const
+{
+    vector<CanonicalNode> form;
+    canonicalForm(form);
+    return form.empty() ? 0 : form.back().hash;
 }
 
-/** Recursive helper function for isEquivalent() function.
+/** Returns the number of variables
+* in the expression.
+* @return int is one more than the highest variable index.
+*/
+template<typename DataType>
+int ExprTree<DataType>::getNumVariables() const
+{
+    return variableNames.getCount();
+}
+
+/** Returns the index
+* of the variable called name, which is its position in the values passed to
+* evaluate().
+* @param name is the name of the variable.
+* @return int is the index of the variable, or -1 if the expression has no
+* such variable.
+*/
+template<typename DataType>
+int ExprTree<DataType>::getVariableIndex(const string& name) const
+{
+    return variableNames.getIndex(name);
+}
+
+/** Returns the name
+* of the variable with the given index.
+* @param index is the index of the variable.
+* @return string is the name of the variable.
+* @throw There is no variable with that index.
+*/
+template<typename DataType>
+string ExprTree<DataType>::getVariableName(int index) const
+    throw (logic_error)
+{
+    return variableNames.getName(index);
+}
+
+/** Helper function for isEquivalent() function.
+* Compares the canonical forms of two trees from their roots, pair of nodes
+* by pair of nodes. The stack holds the pairs still to be compared.
+* @param dest is the canonical form of this ExprTree.
+* @param sourceTree is the tree compared to.
+* @param source is the canonical form of sourceTree.
 * @see isEquivalent()
 */
 template<typename DataType>
-bool ExprTree<DataType>::isEquivHelper(ExprTreeNode *dest, 
-    ExprTreeNode *source) const
+bool ExprTree<DataType>::isEquivHelper(const vector<CanonicalNode>& dest,
+    const ExprTree& sourceTree, const vector<CanonicalNode>& source) const
 {
-    //It's equivalent if the nodes are empty
-    if(dest == NULL && source == NULL)
+    //Empty trees are only equivalent to each other
+    if(dest.size() != source.size())
+        return false;
+    if(dest.empty())
         return true;
-    //The nodes aren't empty
-    else if (dest != NULL && source != NULL)
+    if(dest.back().hash != source.back().hash)
+        return false;
+
+    vector< pair<int, int> > pending;
+    pending.push_back(make_pair(int(dest.size()) - 1,
+        int(source.size()) - 1));
+    while(!pending.empty())
     {
-        //The two data items are equivalent
-        if(dest->dataItem == source->dataItem)
+        const CanonicalNode& d = dest[pending.back().first];
+        const CanonicalNode& s = source[pending.back().second];
+        pending.pop_back();
+        if(d.hash != s.hash || !isSameItem(d.node, sourceTree, s.node))
+            return false;
+        if(d.left >= 0)
         {
-            //Check if non-swap is equivalent
-            if(isEquivHelper(dest->left, source->left) &&
-                isEquivHelper(dest->right, source->right))
-                return true;
-            //Check is swap is equivalent
-            else if (isEquivHelper(dest->left, source->right) &&
-                isEquivHelper(dest->right, source->left))
-            {
-                //Addition and multiplication can commute
-                if(dest->dataItem == '+' || dest->dataItem == '*')
-                    return true;
-                //Subtraction and division cannot commute
-                else
-                    return false;
-            }
-            else
-                return false;
+            pending.push_back(make_pair(d.right, s.right));
+            pending.push_back(make_pair(d.left, s.left));
         }
     }
-    return false;
+    return true;
+}
+
+/** Builds the canonical form
+* of the expression tree in postorder, so the operands of every node come
+* before it. The hash of a node is computed from its data item and the hashes
+* of its operands, and the operands of + and * are ordered by their hashes.
+* Variables are hashed by name, so the hash does not depend on the order the
+* variables appear in.
+* @param form receives the nodes. The root is the last node.
+* @see isEquivalent(), canonicalize(), getCanonicalHash()
+*/
+template<typename DataType>
+void ExprTree<DataType>::canonicalForm(vector<CanonicalNode>& form) const
+{
+    form.clear();
+    if(root == NULL)
+        return;
+
+    //Hash every variable name once, not at every leaf
+    vector<size_t> variableHashes(variableNames.getCount());
+    for(int i = 0; i < variableNames.getCount(); i++)
+        variableHashes[i] = combineExprHash(combineExprHash(0, VARIABLE),
+            std::hash<string>()(variableNames[i]));
+
+    //The indexes in form of the operands added so far; operators follow both
+    //of their operands
+    vector<int> operands;
+    ExprTreeNode *p = root;
+    postorderHelper(p, [&form, &variableHashes, &operands](ExprTreeNode *&q)
+    {
+        if(!isOperator(q->dataItem))
+        {
+            CanonicalNode leaf = { q, -1, -1, false,
+                (q->dataItem == VARIABLE) ? variableHashes[q->variable] :
+                itemHash(q) };
+            operands.push_back(form.size());
+            form.push_back(leaf);
+            return;
+        }
+        CanonicalNode node = { q, 0, operands.back(), false, 0 };
+        operands.pop_back();
+        node.left = operands.back();
+        if((q->dataItem == '+' || q->dataItem == '*') &&
+            form[node.left].hash > form[node.right].hash)
+        {
+            swap(node.left, node.right);
+            node.isSwapped = true;
+        }
+        node.hash = combineExprHash(combineExprHash(itemHash(q),
+            form[node.left].hash), form[node.right].hash);
+        operands.back() = form.size();
+        form.push_back(node);
+    });
+}
+
+/** Returns the hash
+* of the data item of p: its operator or its number. Variables are hashed by
+* canonicalForm().
+* @param p is an operator or NUMBER node.
+* @return size_t is the hash.
+*/
+template<typename DataType>
+size_t ExprTree<DataType>::itemHash(ExprTreeNode *p)
+{
+    size_t hash = combineExprHash(0, p->dataItem);
+    if(p->dataItem == NUMBER)
+        return combineExprHash(hash, std::hash<DataType>()(p->value));
+    return hash;
+}
+
+/** Returns true if dest and source
+* hold the same operator, number or variable. Variables are compared by name,
+* since each tree numbers its own variables. Otherwise, returns false.
+* @param dest is a node of this ExprTree.
+* @param sourceTree is the tree holding source.
+* @param source is a node of sourceTree.
+* @return The data items are the same or not.
+*/
+template<typename DataType>
+bool ExprTree<DataType>::isSameItem(ExprTreeNode *dest,
+    const ExprTree& sourceTree, ExprTreeNode *source) const
+{
+    if(dest->dataItem != source->dataItem)
+        return false;
+    if(dest->dataItem == NUMBER)
+        return (dest->value == source->value);
+    if(dest->dataItem == VARIABLE)
+        return (variableNames[dest->variable] ==
+            sourceTree.variableNames[source->variable]);
+    return true;
+}
+
+/** Outputs the data item
+* of p: its operator, number or variable name.
+* @param p is the node to output.
+*/
+template<typename DataType>
+void ExprTree<DataType>::showItem(ExprTreeNode *p) const
+{
+    if(p->dataItem == NUMBER)
+        cout << p->value;
+    else if(p->dataItem == VARIABLE)
+        cout << variableNames[p->variable];
+    else
+        cout << p->dataItem;
 }
 
 /** Outputs an expression tree
 * with its branches orientated from left (root) to right (leaves). The tree
 * output is rotated counterclockwise ninty degrees from the conventional
 * orientation. If the tree is empty, it outputs "Empty tree." This function is
-* for testing purposes only and assumes arithmetic expressions contain only
-* single-digit, non-negative integers, and the arithmetic operators for
-* addition, subtraction, multiplication, and division.
+* for testing purposes only.
 * @post The expression tree will be outputed to the console.
 */
 template<typename DataType>
@@ -366,7 +1075,8 @@ void ExprTree<DataType>::showHelper(ExprTreeNode *p, int level) const
         showHelper(p->right,level+1);        // Output right subtree
         for ( j = 0 ; j < level ; j++ )   // Tab over to level
             cout << "\t";
-        cout << " " << p->dataItem;        // Output dataItem
+        cout << " ";                      // Output dataItem
+        showItem(p);
         if ( ( p->left != 0 ) &&          // Output "connector"
              ( p->right != 0 ) )
            cout << "<";
@@ -391,6 +1101,30 @@ ExprTree<DataType>::ExprTreeNode::ExprTreeNode(char elem, ExprTreeNode *leftPtr,
     ExprTreeNode *rightPtr)
 {
     dataItem = elem;
+    value = DataType();
+    variable = -1;
+    size = 1 + (leftPtr == NULL ? 0 : leftPtr->size) +
+        (rightPtr == NULL ? 0 : rightPtr->size);
     left = leftPtr;
     right = rightPtr;
+}
+
+/** The parameterized constructor
+* that sets ExprTreeNode's data item, number and variable index. The node has
+* no children.
+* @post This ExprTreeNode will be a valid ExprTreeNode.
+* @param elem is the operator, NUMBER or VARIABLE.
+* @param number is the value of a NUMBER.
+* @param index is the index of a VARIABLE.
+*/
+template<typename DataType>
+ExprTree<DataType>::ExprTreeNode::ExprTreeNode(char elem,
+    const DataType& number, int index)
+{
+    dataItem = elem;
+    value = number;
+    variable = index;
+    size = 1;
+    left = NULL;
+    right = NULL;
 }
\ No newline at end of file
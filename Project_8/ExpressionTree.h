@@ -17,9 +17,20 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <string>
+#include <vector>
+#include "ExprOperator.h"
+#include "ExprHash.h"
+#include "ExprVariables.h"
+#include "ExprProgram.h"
+#include "ExprDag.h"
+#include "ExprScanner.h"
 
 using namespace std;
 
+template <typename DataType>
+class ExprParallel;
+
 template <typename DataType>
 class ExprTree {
   public:
@@ -34,44 +45,100 @@ class ExprTree {
     ~ExprTree ();
 
     // Expression tree manipulation operations
-    void build ();
+    void build () throw (logic_error);          // From the keyboard
+    void build (istream& input) throw (logic_error);
+    void build (const char* text, size_t length) throw (logic_error);
+    void build (const string& text) throw (logic_error);
     void expression () const;
-    DataType evaluate() const throw (logic_error);
+    DataType evaluate(const DataType variables[] = NULL) const
+        throw (logic_error);
+    void evaluateColumns(const DataType* const variables[], int count,
+                         DataType results[]) const throw (logic_error);
+    void compile(ExprProgram<DataType>& program) const throw (logic_error);
+    int intern(ExprDag<DataType>& dag) const throw (logic_error);
     void clear ();              // Clear tree
     void commute();
+    void simplify();            // Fold constants and identities
     bool isEquivalent(const ExprTree& source) const;
+    void canonicalize ();       // Order the operands of + and * by hash
+    size_t getCanonicalHash () const;
+
+    int getSize () const;       // Number of nodes
+
+    // Variables, numbered in order of first appearance
+    int getNumVariables () const;
+    int getVariableIndex (const string& name) const;    // -1 if absent
+    string getVariableName (int index) const throw (logic_error);
 
     // Output the tree structure -- used in testing/debugging
     void showStructure () const;
 
   private:
 
+    // Evaluates the subtrees on a TaskPool, with the helpers below
+    friend class ExprParallel<DataType>;
+
     class ExprTreeNode {
       public:
-        // Constructor
+        // Constructors
         ExprTreeNode ( char elem,
                        ExprTreeNode *leftPtr, ExprTreeNode *rightPtr );
+        ExprTreeNode ( char elem, const DataType& number, int index );
 
         // Data members
-        char dataItem;          // Expression tree data item
+        char dataItem;          // Operator, NUMBER or VARIABLE
+        DataType value;         // Value of a NUMBER
+        int variable;           // Index of a VARIABLE
+        int size;               // Nodes in the subtree
         ExprTreeNode *left,     // Pointer to the left child
                      *right;    // Pointer to the right child
     };
 
-    // Recursive helper functions for the public member functions -- insert
-    // prototypes of these functions here.
+    // A node of the canonical form of the tree, in which the operands
+    // of + and * are ordered by their hash
+    struct CanonicalNode {
+        ExprTreeNode *node;     // Node of the tree
+        int left, right;        // Operands in canonical order, or -1
+        bool isSwapped;         // Operands are the other way in the tree
+        size_t hash;            // Hash of the canonical subexpression
+    };
+
+    // Data items of the leaves
+    static const char NUMBER = '#';
+    static const char VARIABLE = '$';
+
+    // Helper functions for the public member functions. They use explicit
+    // stacks rather than recursion, except showHelper.
     void showHelper(ExprTreeNode *p, int level) const;
-    DataType evalHelper(ExprTreeNode *p) const;
-    void buildHelper(ExprTreeNode *&node);
+    DataType evalHelper(ExprTreeNode *p, const DataType variables[]) const;
+    void buildHelper(ExprTreeNode *&node, ExprScanner& scanner);
+    static void sizeHelper(ExprTreeNode *p);
+    template <typename Visitor>
+    static void postorderHelper(ExprTreeNode *&p, Visitor visit);
     void copyHelper(ExprTreeNode *&dest, ExprTreeNode *source);
     void expressionHelper(ExprTreeNode *p) const;
     void clearHelper(ExprTreeNode *&p);
     void commuteHelper(ExprTreeNode *&p);
-    bool isEquivHelper(ExprTreeNode *dest, ExprTreeNode *source) const;
-
-
-    // Data member
+    static void commuteNode(ExprTreeNode *p);
+    void simplifyHelper(ExprTreeNode *&p);
+    void simplifyNode(ExprTreeNode *&p);
+    static int operandRank(ExprTreeNode *p);
+    bool isEquivHelper(const vector<CanonicalNode>& dest,
+                       const ExprTree& sourceTree,
+                       const vector<CanonicalNode>& source) const;
+    bool isSameItem(ExprTreeNode *dest, const ExprTree& sourceTree,
+                    ExprTreeNode *source) const;
+    void canonicalForm(vector<CanonicalNode>& form) const;
+    static size_t itemHash(ExprTreeNode *p);
+    void showItem(ExprTreeNode *p) const;
+    static bool isOperator(char dataItem);
+    static DataType leafValue(ExprTreeNode *p, const DataType variables[])
+        throw (logic_error);
+
+
+    // Data members
     ExprTreeNode *root;   // Pointer to the root node
+    ExprVariables variableNames;    // Names by index, indexes by name
 };
 
 #endif		// #ifndef EXPRESSIONTREE_H
@@ -21,6 +21,9 @@ using namespace std;
 template <typename DataType>
 void dummy ( ExprTree<DataType> copyTree );   // copyTree is passed by value
 
+template <typename DataType>
+bool readExpression ( ExprTree<DataType>& tree );  // false if malformed
+
 //--------------------------------------------------------------------
 
 int main()
@@ -34,9 +37,11 @@ int main()
     cout << "Start of testing the basic expression tree" << endl;
     ExprTree<float> testExpression;  // Test expression
 
-    cout << endl << "Enter an expression in prefix form : ";
+    cout << endl << "Enter an expression in prefix form, with spaces"
+         << " between the tokens : ";
 
-    testExpression.build();
+    if ( !readExpression(testExpression) )
+        return 1;
     testExpression.showStructure();
     testExpression.expression();
     cout << " = " << testExpression.evaluate() << endl;
@@ -50,8 +55,10 @@ int main()
 #if LAB8_TEST1
     cout << "Start of testing the boolean expression tree" << endl;
     ExprTree<bool> boolTree;
-    cout << endl << "Enter a boolean expression in prefix form : ";
-    boolTree.build();
+    cout << endl << "Enter a boolean expression in prefix form, with spaces"
+         << " between the tokens : ";
+    if ( !readExpression(boolTree) )
+        return 1;
     boolTree.showStructure();
     boolTree.expression();
     cout << " = " << boolTree.evaluate() << endl;
@@ -79,8 +86,10 @@ int main()
     cout << (empty.isEquivalent(testExpression) ? "Yes" : "No") << endl;
 
     ExprTree<float> userExpression;
-    cout << "Enter another expression in prefix form: ";
-    userExpression.build();
+    cout << "Enter another expression in prefix form, with spaces"
+         << " between the tokens: ";
+    if ( !readExpression(userExpression) )
+        return 1;
     cout << "new expression is equal?  ";
     cout << (userExpression.isEquivalent(testExpression) ? "Yes" : "No") << endl;
     cout << "** End of testing isEquivalent()" << endl;
@@ -113,3 +122,25 @@ void dummy ( ExprTree<DataType> copyTree )
     copyTree.showStructure();
 }
 
+
+//--------------------------------------------------------------------
+
+template <typename DataType>
+bool readExpression ( ExprTree<DataType>& tree )
+
+// Builds tree from the expression entered at the keyboard. Outputs why
+// the expression is malformed and returns false if it cannot be read,
+// for instance if its tokens are not separated by spaces.
+
+{
+    try
+    {
+        tree.build();
+        return true;
+    }
+    catch ( logic_error& e )
+    {
+        cout << endl << "Malformed expression: " << e.what() << endl;
+        return false;
+    }
+}
@@ -0,0 +1,670 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 8                                          timeexpr.cpp
+//
+//  Times the operations of the Expression Tree ADT on deep skewed
+//  trees and on balanced trees, and compares the other ways of
+//  evaluating and comparing expressions with them: the compiled
+//  ExprProgram row by row and by column, the shared subexpressions
+//  of an ExprDag, evaluation on a thread pool, simplify(),
+//  equivalence by canonical form, and expression templates. Also
+//  times parsing a large expression from memory and from a stream.
+//  Build with -pthread.
+//
+//--------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "config.h"
+
+using namespace std;
+
+#include "ExpressionTree.cpp"
+#include "ExprParallel.cpp"
+#include "ExprTemplate.h"
+#include "../Project_13/Timer.cpp"
+
+//--------------------------------------------------------------------
+//
+// Prefix expressions
+//
+
+// Returns + 1 + 1 ... + 1 1: every operator's right operand is
+// the next operator, so the tree is numOperators deep.
+string rightSkewed(int numOperators)
+{
+    string prefix;
+    for (int i = 0; i < numOperators; ++i)
+	prefix += "+ 1 ";
+    return prefix + "1";
+}
+
+// Returns + + ... + 1 1 1 ... 1: every operator's left operand is
+// the next operator, so the tree is numOperators deep.
+string leftSkewed(int numOperators)
+{
+    string prefix;
+    for (int i = 0; i < numOperators; ++i)
+	prefix += "+ ";
+    for (int i = 0; i < numOperators; ++i)
+	prefix += "1 ";
+    return prefix + "1";
+}
+
+// Returns a full tree of the given height whose leaves are drawn
+// from the words of leaves. Its operators are drawn from + and -,
+// and * just above the leaves, so the value cannot overflow. If
+// order is not 0, it switches the operands of + and * at random,
+// which gives an equivalent tree for the same seed.
+void appendBalanced(string& prefix, int height,
+		    const vector<string>& leaves, unsigned& seed,
+		    unsigned& order)
+{
+    seed = seed * 1103515245 + 12345;
+    if (height == 0) {
+	prefix += leaves[(seed >> 16) % leaves.size()];
+	prefix += ' ';
+	return;
+    }
+    char op = (height == 1) ? "+-*"[(seed >> 16) % 3] :
+	"+-"[(seed >> 16) % 2];
+    prefix += op;
+    prefix += ' ';
+    if (order == 0 || op == '-') {
+	appendBalanced(prefix, height - 1, leaves, seed, order);
+	appendBalanced(prefix, height - 1, leaves, seed, order);
+	return;
+    }
+    order = order * 1103515245 + 12345;
+    bool isSwapped = (order >> 16) % 2;
+    string left, right;
+    appendBalanced(left, height - 1, leaves, seed, order);
+    appendBalanced(right, height - 1, leaves, seed, order);
+    prefix += isSwapped ? right + left : left + right;
+}
+
+// Appends T(height), where T(0) = a, T(h) = + T(h-1) U(h-1), U(0) = b
+// and U(h) = + T(h-1) T(h-1). If isMirrored, the operands of every T
+// are switched, which gives an equivalent tree. A comparison that
+// tries both orders of the operands backtracks a long way over the
+// nearly equal subtrees before it finds the right one.
+void appendNearlyEqual(string& prefix, int height, bool isU,
+		       bool isMirrored)
+{
+    if (height == 0) {
+	prefix += isU ? "b " : "a ";
+	return;
+    }
+    prefix += "+ ";
+    if (isMirrored && !isU) {
+	appendNearlyEqual(prefix, height - 1, true, isMirrored);
+	appendNearlyEqual(prefix, height - 1, false, isMirrored);
+    } else {
+	appendNearlyEqual(prefix, height - 1, false, isMirrored);
+	appendNearlyEqual(prefix, height - 1, !isU, isMirrored);
+    }
+}
+
+string balanced(int height, const string& leaves = "1",
+		unsigned seed = 1, unsigned order = 0)
+{
+    istringstream words(leaves);
+    vector<string> leafWords;
+    string word;
+    while (words >> word)
+	leafWords.push_back(word);
+
+    string prefix;
+    appendBalanced(prefix, height, leafWords, seed, order);
+    return prefix;
+}
+
+//--------------------------------------------------------------------
+//
+// Timing
+//
+
+// Builds the tree for prefix and times every operation on it.
+void timeOperations(const string& prefix, int numEvaluations,
+		    const string& name)
+{
+    ExprTree<float> tree;
+    Timer t;
+
+    t.start();
+    tree.build(prefix);
+    t.stop();
+    cout << name << endl << "  build       : " << t.getElapsedTime()
+	 << " sec" << endl;
+
+    float value = 0;
+    t.start();
+    for (int i = 0; i < numEvaluations; ++i)
+	value = tree.evaluate();
+    t.stop();
+    cout << "  evaluate    : " << t.getElapsedTime() / numEvaluations
+	 << " sec (value " << value << ")" << endl;
+
+    ostringstream output;
+    streambuf* screen = cout.rdbuf(output.rdbuf());
+    t.start();
+    tree.expression();
+    t.stop();
+    cout.rdbuf(screen);
+    cout << "  expression  : " << t.getElapsedTime() << " sec ("
+	 << output.str().length() << " chars)" << endl;
+
+    t.start();
+    ExprTree<float> copy(tree);
+    t.stop();
+    cout << "  copy        : " << t.getElapsedTime() << " sec" << endl;
+
+    t.start();
+    copy.commute();
+    t.stop();
+    cout << "  commute     : " << t.getElapsedTime() << " sec" << endl;
+
+    t.start();
+    bool same = tree.isEquivalent(copy);
+    t.stop();
+    cout << "  isEquivalent: " << t.getElapsedTime() << " sec ("
+	 << (same ? "Yes" : "No") << ")" << endl;
+
+    t.start();
+    tree.clear();
+    copy.clear();
+    t.stop();
+    cout << "  clear (two) : " << t.getElapsedTime() << " sec" << endl;
+}
+
+// Prints the time of evaluating numRows rows of values.
+void reportRows(const string& name, double seconds, int numRows,
+		double numNodes, float checksum)
+{
+    cout << "  " << name << ": " << seconds * 1e9 / (numRows * numNodes)
+	 << " ns/node, " << numRows / seconds / 1e6
+	 << " M evaluations/sec (checksum " << checksum << ")" << endl;
+}
+
+// Evaluates a balanced tree of the given height with variables a to h
+// for numRows rows of values: through the tree, through its compiled
+// program one row at a time, through the program in one batch, and
+// through the program a block of columns at a time.
+void timeCompiled(int height, int numRows)
+{
+    ExprTree<float> tree;
+    tree.build(balanced(height, "a 1 b 0 c 1 d 0 e 1 f 0 g 1 h"));
+    ExprProgram<float> program;
+    tree.compile(program);
+
+    // One row of values for every evaluation, kept small so the
+    // value does not overflow, and the same values by column
+    const int NUM_VARIABLES = program.getNumVariables();
+    vector<float> variables(numRows * NUM_VARIABLES);
+    for (size_t i = 0; i < variables.size(); ++i)
+	variables[i] = 0.5f + (i % 5) * 0.25f;
+    vector< vector<float> > columns(NUM_VARIABLES, vector<float>(numRows));
+    vector<const float*> columnPtrs(NUM_VARIABLES);
+    for (int j = 0; j < NUM_VARIABLES; ++j) {
+	for (int i = 0; i < numRows; ++i)
+	    columns[j][i] = variables[i * NUM_VARIABLES + j];
+	columnPtrs[j] = &columns[j][0];
+    }
+    vector<float> results(numRows);
+    double numNodes = (2 << height) - 1;
+    float checksum;
+    Timer t;
+
+    cout << "Height " << height << ", " << numRows << " rows ("
+	 << program.getLength() << " instructions for "
+	 << numNodes << " nodes)" << endl;
+
+    checksum = 0;
+    t.start();
+    for (int i = 0; i < numRows; ++i)
+	checksum += tree.evaluate(&variables[i * NUM_VARIABLES]);
+    t.stop();
+    reportRows("tree           ", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+
+    checksum = 0;
+    t.start();
+    for (int i = 0; i < numRows; ++i)
+	checksum += program.evaluate(&variables[i * NUM_VARIABLES]);
+    t.stop();
+    reportRows("program        ", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+
+    checksum = 0;
+    t.start();
+    program.evaluateBatch(&variables[0], numRows, &results[0]);
+    for (int i = 0; i < numRows; ++i)
+	checksum += results[i];
+    t.stop();
+    reportRows("program batch  ", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+
+    checksum = 0;
+    t.start();
+    program.evaluateColumns(&columnPtrs[0], numRows, &results[0]);
+    for (int i = 0; i < numRows; ++i)
+	checksum += results[i];
+    t.stop();
+    reportRows("program columns", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+}
+
+// Adds a balanced tree of the given height with few distinct leaves
+// to an ExprDag, and compares the tree with the DAG.
+void timeDag(int height, int numEvaluations)
+{
+    ExprTree<float> tree;
+    tree.build(balanced(height, "a b 1 2"));
+    ExprTree<float> copy(tree);
+    ExprDag<float> dag;
+    float variables[] = { 0.5f, 0.75f };
+    float value = 0;
+    Timer t;
+
+    cout << "DAG of height " << height << endl;
+
+    t.start();
+    int node = tree.intern(dag);
+    t.stop();
+    cout << "  intern      : " << t.getElapsedTime() << " sec ("
+	 << dag.getTreeSize(node) << " tree nodes, " << dag.getSize()
+	 << " DAG nodes)" << endl;
+
+    t.start();
+    for (int i = 0; i < numEvaluations; ++i)
+	value = tree.evaluate(variables);
+    t.stop();
+    cout << "  tree eval   : " << t.getElapsedTime() / numEvaluations
+	 << " sec (value " << value << ")" << endl;
+
+    t.start();
+    for (int i = 0; i < numEvaluations; ++i)
+	value = dag.evaluate(node, variables);
+    t.stop();
+    cout << "  DAG eval    : " << t.getElapsedTime() / numEvaluations
+	 << " sec (value " << value << ")" << endl;
+
+    t.start();
+    bool same = tree.isEquivalent(copy);
+    t.stop();
+    cout << "  tree equal  : " << t.getElapsedTime() << " sec ("
+	 << (same ? "Yes" : "No") << ")" << endl;
+
+    int copyNode = copy.intern(dag);
+    t.start();
+    same = dag.isIdentical(node, copyNode);
+    t.stop();
+    cout << "  DAG equal   : " << t.getElapsedTime() << " sec ("
+	 << (same ? "Yes" : "No") << ", " << dag.getSize()
+	 << " DAG nodes after the copy)" << endl;
+}
+
+// Evaluates balanced trees of heights up to maxHeight serially and
+// on pools of 1, 2, 4 and 8 threads, reporting the speedup of each
+// and whether its value is the same as the serial value.
+void timeParallel(int maxHeight, int numEvaluations)
+{
+    const int THREADS[] = { 1, 2, 4, 8 };
+    const int NUM_POOLS = sizeof(THREADS) / sizeof(THREADS[0]);
+    vector<TaskPool*> pools;
+    for (int i = 0; i < NUM_POOLS; ++i)
+	pools.push_back(new TaskPool(THREADS[i]));
+    float variables[] = { 0.5f, 0.75f, 1.25f, 1.5f };
+    Timer t;
+
+    cout << "Parallel evaluation (" << thread::hardware_concurrency()
+	 << " hardware threads, cutoff " << ExprParallel<float>::DEFAULT_CUTOFF
+	 << " nodes)" << endl;
+    for (int height = 12; height <= maxHeight; height += 4) {
+	ExprTree<float> tree;
+	tree.build(balanced(height, "a 1 b 0 c 1 d 0.5"));
+	float serial = 0;
+	t.start();
+	for (int i = 0; i < numEvaluations; ++i)
+	    serial = tree.evaluate(variables);
+	t.stop();
+	double serialTime = t.getElapsedTime() / numEvaluations;
+	cout << "  height " << height << " (" << tree.getSize()
+	     << " nodes): serial " << serialTime << " sec" << endl;
+
+	for (int j = 0; j < NUM_POOLS; ++j) {
+	    ExprParallel<float> parallel(*pools[j]);
+	    float value = 0;
+	    t.start();
+	    for (int i = 0; i < numEvaluations; ++i)
+		value = parallel.evaluate(tree, variables);
+	    t.stop();
+	    double time = t.getElapsedTime() / numEvaluations;
+	    cout << "    " << THREADS[j] << " threads: " << time
+		 << " sec, speedup " << serialTime / time
+		 << (value == serial ? "" : " (DIFFERENT VALUE)") << endl;
+	}
+    }
+
+    for (int i = 0; i < NUM_POOLS; ++i)
+	delete pools[i];
+}
+
+// Simplifies balanced trees of heights 1 to maxHeight with leaves
+// that give constant subexpressions and identities, and compares
+// their size and evaluation time before and after.
+void timeSimplify(int maxHeight, int numEvaluations)
+{
+    vector< ExprTree<float> > corpus(maxHeight);
+    for (int i = 0; i < maxHeight; ++i)
+	corpus[i].build(balanced(i + 1, "x 0 1 2 y 1 0.5 3"));
+    vector< ExprTree<float> > simplified(corpus);
+    float variables[] = { 0.5f, 0.75f };
+    float checksum;
+    Timer t;
+
+    cout << "Simplify " << maxHeight << " trees" << endl;
+
+    int sizeBefore = 0;
+    for (int i = 0; i < maxHeight; ++i)
+	sizeBefore += corpus[i].getSize();
+    t.start();
+    for (int i = 0; i < maxHeight; ++i)
+	simplified[i].simplify();
+    t.stop();
+    int sizeAfter = 0;
+    for (int i = 0; i < maxHeight; ++i)
+	sizeAfter += simplified[i].getSize();
+    cout << "  simplify    : " << t.getElapsedTime() << " sec ("
+	 << sizeBefore << " nodes -> " << sizeAfter << ")" << endl;
+
+    for (int pass = 0; pass < 2; ++pass) {
+	vector< ExprTree<float> >& trees = pass ? simplified : corpus;
+	checksum = 0;
+	t.start();
+	for (int n = 0; n < numEvaluations; ++n)
+	    for (int i = 0; i < maxHeight; ++i)
+		checksum += trees[i].evaluate(variables);
+	t.stop();
+	cout << (pass ? "  after       : " : "  before      : ")
+	     << t.getElapsedTime() / numEvaluations << " sec (checksum "
+	     << checksum << ")" << endl;
+    }
+}
+
+// Compares a balanced tree of the given height with an equivalent
+// one whose operands of + and * are switched at random, and a tree
+// of nearly equal subtrees with its mirror. Then deduplicates
+// numTrees random trees of height 10 drawn from numDistinct seeds.
+void timeEquivalence(int height, int numTrees, int numDistinct)
+{
+    const string LEAVES = "a b c d 1 2 3";
+    ExprTree<float> tree, variant;
+    tree.build(balanced(height, LEAVES));
+    variant.build(balanced(height, LEAVES, 1, 7));
+    Timer t;
+
+    cout << "Equivalence of height " << height << endl;
+
+    t.start();
+    bool same = tree.isEquivalent(variant);
+    t.stop();
+    cout << "  isEquivalent: " << t.getElapsedTime() << " sec ("
+	 << (same ? "Yes" : "No") << ")" << endl;
+
+    t.start();
+    same = (tree.getCanonicalHash() == variant.getCanonicalHash());
+    t.stop();
+    cout << "  hash (two)  : " << t.getElapsedTime() << " sec ("
+	 << (same ? "Same" : "Different") << ")" << endl;
+
+    string prefix;
+    appendNearlyEqual(prefix, height, false, false);
+    tree.build(prefix);
+    prefix.clear();
+    appendNearlyEqual(prefix, height, false, true);
+    variant.build(prefix);
+    t.start();
+    same = tree.isEquivalent(variant);
+    t.stop();
+    cout << "  nearly equal: " << t.getElapsedTime() << " sec ("
+	 << (same ? "Yes" : "No") << ")" << endl;
+
+    // Trees with the same canonical hash are compared in full
+    vector< ExprTree<float> > trees(numTrees);
+    for (int i = 0; i < numTrees; ++i)
+	trees[i].build(balanced(10, LEAVES, 1 + i % numDistinct,
+				1 + i));
+    unordered_map< size_t, vector<int> > classes;
+    int numClasses = 0;
+    t.start();
+    for (int i = 0; i < numTrees; ++i) {
+	vector<int>& candidates = classes[trees[i].getCanonicalHash()];
+	bool isNew = true;
+	for (size_t j = 0; j < candidates.size() && isNew; ++j)
+	    isNew = !trees[candidates[j]].isEquivalent(trees[i]);
+	if (isNew) {
+	    candidates.push_back(i);
+	    ++numClasses;
+	}
+    }
+    t.stop();
+    cout << "  deduplicate : " << t.getElapsedTime() << " sec ("
+	 << numTrees << " trees, " << numClasses << " distinct)" << endl;
+}
+
+// Returns the values of the template variables x0 to x(numVariables-1)
+// in the order of the indexes of the tree built from a prefix form,
+// which numbers its variables by first appearance.
+vector<float> bindVariables(const ExprTree<float>& tree,
+			    const float variables[], int numVariables)
+{
+    vector<float> bound(tree.getNumVariables());
+    for (int i = 0; i < numVariables; ++i) {
+	ostringstream name;
+	name << "x" << i;
+	int index = tree.getVariableIndex(name.str());
+	if (index >= 0)
+	    bound[index] = variables[i];
+    }
+    return bound;
+}
+
+// Checks that the trees built from the prefix forms of formulas with
+// negative numbers, -0 among them, and with variables out of the order
+// of their indexes give the same values as the formulas, and that a
+// formula with an infinite number has no prefix form.
+void checkTemplatePrefix()
+{
+    ExprVariable<0> x0;
+    ExprVariable<1> x1;
+    float variables[] = { -0.0f, 0.75f };
+    float outOfOrderVariables[] = { 10.0f, 3.0f };
+    bool isCorrect = true;
+
+    ExprApply<ExprAdd, ExprApply<ExprMultiply, ExprVariable<0>, ExprNumber>,
+	ExprApply<ExprDivide, ExprVariable<1>, ExprNumber> >
+	negative = x0 * -2.0 + x1 / -0.1;
+    ExprApply<ExprSubtract, ExprVariable<0>, ExprNumber> negativeZero =
+	x0 - -0.0;
+    ExprApply<ExprSubtract, ExprVariable<1>, ExprVariable<0> > outOfOrder =
+	x1 - x0;
+    ExprTree<float> tree;
+    tree.build(negative.prefix());
+    float expected = negative.evaluate(variables);
+    float value = tree.evaluate(&bindVariables(tree, variables, 2)[0]);
+    isCorrect = isCorrect && memcmp(&value, &expected, sizeof(float)) == 0;
+    tree.build(negativeZero.prefix());
+    expected = negativeZero.evaluate(variables);
+    value = tree.evaluate(&bindVariables(tree, variables, 2)[0]);
+    isCorrect = isCorrect && memcmp(&value, &expected, sizeof(float)) == 0;
+    tree.build(outOfOrder.prefix());
+    expected = outOfOrder.evaluate(outOfOrderVariables);
+    value = tree.evaluate(&bindVariables(tree, outOfOrderVariables, 2)[0]);
+    isCorrect = isCorrect && value == expected;
+
+    try {
+	(x0 + HUGE_VAL).prefix();
+	isCorrect = false;
+    }
+    catch (logic_error&) {
+    }
+    cout << "Template prefix round trip : " << (isCorrect ? "OK" : "FAILED")
+	 << " (" << negative.prefix() << ", " << negativeZero.prefix()
+	 << "and " << outOfOrder.prefix() << ")" << endl;
+}
+
+// Evaluates one formula for numRows rows of values as an expression
+// template, and as the tree and the program built from its prefix
+// form. The values are bound to the variables of the tree by name.
+void timeTemplate(int numRows)
+{
+    ExprVariable<0> x0;
+    ExprVariable<1> x1;
+    ExprVariable<2> x2;
+    ExprVariable<3> x3;
+    ExprVariable<4> x4;
+    ExprVariable<5> x5;
+    const int NUM_VARIABLES = 6;
+    ExprApply<ExprSubtract, ExprApply<ExprMultiply, ExprApply<ExprAdd,
+	ExprApply<ExprMultiply, ExprApply<ExprAdd, ExprVariable<0>,
+	ExprNumber>, ExprApply<ExprSubtract, ExprVariable<1>,
+	ExprApply<ExprMultiply, ExprVariable<2>, ExprNumber> > >,
+	ExprApply<ExprDivide, ExprVariable<3>, ExprApply<ExprAdd,
+	ExprVariable<4>, ExprNumber> > >, ExprVariable<5> >, ExprNumber>
+	formula = ((x0 + 2) * (x1 - x2 * 0.5) + x3 / (x4 + 1)) * x5 - 3;
+
+    ExprTree<float> tree;
+    tree.build(formula.prefix());
+    ExprProgram<float> program;
+    tree.compile(program);
+
+    vector<float> variables(numRows * NUM_VARIABLES);
+    for (size_t i = 0; i < variables.size(); ++i)
+	variables[i] = 0.5f + (i % 5) * 0.25f;
+    vector<float> treeVariables(numRows * NUM_VARIABLES);
+    for (int i = 0; i < numRows; ++i) {
+	vector<float> bound = bindVariables(tree,
+	    &variables[i * NUM_VARIABLES], NUM_VARIABLES);
+	copy(bound.begin(), bound.end(), &treeVariables[i * NUM_VARIABLES]);
+    }
+    vector< vector<float> > columns(NUM_VARIABLES, vector<float>(numRows));
+    vector<const float*> columnPtrs(NUM_VARIABLES);
+    for (int j = 0; j < NUM_VARIABLES; ++j) {
+	for (int i = 0; i < numRows; ++i)
+	    columns[j][i] = treeVariables[i * NUM_VARIABLES + j];
+	columnPtrs[j] = &columns[j][0];
+    }
+    vector<float> results(numRows);
+    double numNodes = tree.getSize();
+    float checksum;
+    Timer t;
+
+    cout << "Formula " << formula.prefix() << endl;
+
+    checksum = 0;
+    t.start();
+    for (int i = 0; i < numRows; ++i)
+	checksum += tree.evaluate(&treeVariables[i * NUM_VARIABLES]);
+    t.stop();
+    reportRows("tree           ", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+
+    checksum = 0;
+    t.start();
+    for (int i = 0; i < numRows; ++i)
+	checksum += program.evaluate(&treeVariables[i * NUM_VARIABLES]);
+    t.stop();
+    reportRows("program        ", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+
+    checksum = 0;
+    t.start();
+    program.evaluateColumns(&columnPtrs[0], numRows, &results[0]);
+    for (int i = 0; i < numRows; ++i)
+	checksum += results[i];
+    t.stop();
+    reportRows("program columns", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+
+    checksum = 0;
+    t.start();
+    for (int i = 0; i < numRows; ++i)
+	checksum += formula.evaluate(&variables[i * NUM_VARIABLES]);
+    t.stop();
+    reportRows("template       ", t.getElapsedTime(), numRows, numNodes,
+	       checksum);
+}
+
+// Parses a balanced tree of the given height with multi-digit and
+// floating-point numbers and named variables, from a string and
+// from a stream.
+void timeParse(int height)
+{
+    string prefix = balanced(height,
+	"12 0.75 rate x1 3.5e2 count 42 y_0 1024 total 6.25");
+    double megabytes = prefix.length() / 1e6;
+    double numNodes = (2 << height) - 1;
+    ExprTree<double> tree;
+    Timer t;
+
+    cout << "Parse height " << height << " (" << megabytes << " MB, "
+	 << numNodes << " nodes)" << endl;
+
+    t.start();
+    tree.build(prefix);
+    t.stop();
+    cout << "  buffer : " << megabytes / t.getElapsedTime() << " MB/s, "
+	 << numNodes / t.getElapsedTime() << " nodes/s ("
+	 << tree.getNumVariables() << " variables)" << endl;
+
+    istringstream input(prefix);
+    t.start();
+    tree.build(input);
+    t.stop();
+    cout << "  stream : " << megabytes / t.getElapsedTime() << " MB/s, "
+	 << numNodes / t.getElapsedTime() << " nodes/s ("
+	 << tree.getNumVariables() << " variables)" << endl;
+}
+
+//--------------------------------------------------------------------
+
+int main()
+{
+    cout << endl << "Enter the number of operators in the skewed trees: ";
+    int numOperators;
+    cin >> numOperators;
+    cout << "Enter the height of the balanced tree: ";
+    int height;
+    cin >> height;
+    cout << "Enter the number of evaluations: ";
+    int numEvaluations;
+    cin >> numEvaluations;
+    if (!cin || numOperators < 0 || height < 0 || numEvaluations < 1) {
+	cout << "input error" << endl;
+	return 1;
+    }
+
+    timeOperations(rightSkewed(numOperators), numEvaluations,
+		   "Right skewed");
+    timeOperations(leftSkewed(numOperators), numEvaluations,
+		   "Left skewed");
+    timeOperations(balanced(height), numEvaluations, "Balanced");
+
+    timeCompiled(4, numEvaluations * 10000);
+    timeCompiled(10, numEvaluations * 100);
+    timeCompiled(height, numEvaluations);
+
+    timeDag(height, numEvaluations);
+    timeParallel(height, numEvaluations);
+    timeSimplify(height, numEvaluations);
+    timeEquivalence(height, 1000, 100);
+    checkTemplatePrefix();
+    timeTemplate(numEvaluations * 100000);
+    timeParse(20);
+
+    return 0;
+}
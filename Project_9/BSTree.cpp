@@ -10,6 +10,10 @@
 * the tree, all the data items in D's left subtree have keys that are less than 
 * D's key and all the data items in D's right subtree have keys that are greater
 * than D's key.
+* /n The helpers loop down the tree instead of recursing, so a tree made deep
+* by sorted keys cannot overflow the call stack in any operation. They visit the
+* nodes in the same order as recursive versions would, so the results are the
+* same.
 * /n Note: Binary Search Tree == BSTree, Binary Search Tree Node == BSTreeNode
 */
 
@@ -46,9 +50,22 @@ BSTree<DataType,KeyType>::BSTree()
 template<typename DataType, class KeyType>
 BSTree<DataType,KeyType>::BSTree(const BSTree<DataType,KeyType>& other)
 {
+    root = NULL;
     *this = other;
 }
 
+/** The move constructor
+* that takes over the nodes of the other BSTree.
+* @post The other BSTree will be a valid empty BSTree.
+* @param other is the BSTree whose nodes are taken over.
+*/
+template<typename DataType, class KeyType>
+BSTree<DataType,KeyType>::BSTree(BSTree<DataType,KeyType>&& other)
+{
+    root = other.root;
+    other.root = NULL;
+}
+
 /** The overloaded assignment operator
 * that sets this BSTree to be equivalent to the other BSTree object parameter
 * and returrns a reference to this object.
@@ -62,14 +79,36 @@ template<typename DataType, class KeyType>
 BSTree<DataType,KeyType>& BSTree<DataType,KeyType>::operator=(
     const BSTree<DataType,KeyType>& other)
 {
-    if(*this == &other)
+    if(this == &other)
         return *this;
     clear();
     copyHelper(root, other.root);
     return *this;
 }
 
-/** Recursive helper function.
+/** The move assignment operator
+* that releases the nodes of this BSTree and takes over the nodes of the other
+* BSTree.
+* @post The other BSTree will be a valid empty BSTree.
+* @param other is the BSTree whose nodes are taken over.
+* @return The reference to this BSTree.
+*/
+template<typename DataType, class KeyType>
+BSTree<DataType,KeyType>& BSTree<DataType,KeyType>::operator=(
+    BSTree<DataType,KeyType>&& other)
+{
+    if(this == &other)
+        return *this;
+    clear();
+    root = other.root;
+    other.root = NULL;
+    return *this;
+}
+
+/** Helper function for operator=().
+* Each source node waits on a stack with the link that its copy is stored in,
+* and a copied node puts its children on the stack with links to its own
+* children.
 * @param p is the node to copy into (destination node).
 * @param other is the node to copy from (source node).
 * @see BSTree<DataType,KeyType>::operator=(const BSTree<DataType,KeyType>&)
@@ -77,13 +116,20 @@ BSTree<DataType,KeyType>& BSTree<DataType,KeyType>::operator=(
 template<typename DataType, class KeyType>
 void BSTree<DataType,KeyType>::copyHelper(BSTreeNode*& p, BSTreeNode* other)
 {
+    vector< pair<BSTreeNode*, BSTreeNode**> > pending;  //Nodes still to copy
     if(other != NULL)
+        pending.push_back(make_pair(other, &p));
+    while(!pending.empty())
     {
-        BSTreeNode *left = NULL;
-        BSTreeNode *right = NULL;
-        copyHelper(left, other->left);  //Copy left branch
-        copyHelper(right, other-right); //Copy right branch
-        p = new BSTreeNode(other->dataItem, left, right); //Reached leaf
+        BSTreeNode* source = pending.back().first;
+        BSTreeNode** link = pending.back().second;
+        pending.pop_back();
+        *link = new BSTreeNode(source->dataItem, NULL, NULL);
+        //Copy the left branch, then the right branch
+        if(source->right != NULL)
+            pending.push_back(make_pair(source->right, &(*link)->right));
+        if(source->left != NULL)
+            pending.push_back(make_pair(source->left, &(*link)->left));
     }
 }
 
@@ -110,32 +156,51 @@ void BSTree<DataType,KeyType>::insert(const DataType& newDataItem)
     insertHelper(newDataItem, root);
 }
 
-/** Recursive helper function.
+/** Moves newDataItem into this BSTree.
+* Behaves like insert(const DataType&) but moves the data item into its node
+* (or over the data item with the same key) instead of copying it.
+* @post newDataItem will be inserted with respect to left and right BSTreeNodes.
+* @param newDataItem is the data item to be moved into this BSTree.
+*/
+template<typename DataType, class KeyType>
+void BSTree<DataType,KeyType>::insert(DataType&& newDataItem)
+{
+    insertHelper(std::move(newDataItem), root);
+}
+
+/** Helper function for the insert() functions.
+* Follows the links down from p until it finds the data item with the same key
+* or the empty link where the new data item belongs. Forwards newDataItem
+* unchanged so that it is copied or moved only once, when it is stored in the
+* tree.
 * @param newDataItem is the data item to insert into the BSTree.
-* @param p is the current node to check against.
+* @param p is the root of the subtree to insert into.
 * @see BSTree<DataType,KeyType>::insert(const DataType&)
 */
 template<typename DataType, class KeyType>
-void BSTree<DataType,KeyType>::insertHelper(const DataType& newDataItem, 
+template<typename ItemType>
+void BSTree<DataType,KeyType>::insertHelper(ItemType&& newDataItem, 
     BSTreeNode*& p)
 {
-    //Base case, p is NULL so there is room to insert
-    if(p == NULL)
-    {
-        p = new BSTreeNode(newDataItem, NULL, NULL);
-    }
-    else
+    BSTreeNode** link = &p;     //Link to the subtree being searched
+    while(*link != NULL)
     {
+        BSTreeNode* node = *link;
         //new data is equal to, so update
-        if((p->dataItem).getKey() == newDataItem.getKey())
-            p->dataItem = newDataItem;
+        if((node->dataItem).getKey() == newDataItem.getKey())
+        {
+            node->dataItem = std::forward<ItemType>(newDataItem);
+            return;
+        }
         //new data is greater than, so insert left
-        else if((p->dataItem).getKey() > newDataItem.getKey())
-            insertHelper(newDataItem, p->left);
+        else if((node->dataItem).getKey() > newDataItem.getKey())
+            link = &node->left;
         //new data is less than, so insert right
         else
-            insertHelper(newDataItem, p->right);
+            link = &node->right;
     }
+    //The link is NULL so there is room to insert
+    *link = new BSTreeNode(std::forward<ItemType>(newDataItem), NULL, NULL);
 }
 
 /** Searches this BSTree for the data item with key searchKey.
@@ -156,19 +221,20 @@ bool BSTree<DataType,KeyType>::retrieve(const KeyType& searchKey,
     return retrieveHelper(searchKey, searchDataItem, root);
 }
 
-/** Recursive helper function.
+/** Helper function for retrieve().
+* The search follows one path down from p, so it loops instead of recursing.
 * @param searchKey is the key to compare all nodes within the BSTree to.
 * @param searchDataItem will contain the search key's data item if found.
-* @param p is the current node to check against.
+* @param p is the root of the subtree to search.
 * @see BSTree<DataType,KeyType>::retrieve(const KeyType&, DataType&)
 */
 template<typename DataType, class KeyType>
 bool BSTree<DataType,KeyType>::retrieveHelper(const KeyType& searchKey,
     DataType& searchDataItem, BSTreeNode* p) const
 {
-    if(p != NULL)
+    while(p != NULL)
     {
-        //Base case, key has been found in tree
+        //Key has been found in tree
         if(searchKey == (p->dataItem).getKey())
         {
             //Update the search data item
@@ -177,14 +243,13 @@ bool BSTree<DataType,KeyType>::retrieveHelper(const KeyType& searchKey,
         }
         //Key is less than, so check left
         else if (searchKey < (p->dataItem).getKey())
-            return retrieveHelper(searchKey, searchDataItem, p->left);
+            p = p->left;
         //Key is greater than so check right
         else
-            return retrieveHelper(searchKey, searchDataItem, p->right);
+            p = p->right;
     }
-    //Base case, key not found
-    else
-        return false;
+    //Key not found
+    return false;
 }
 
 /** Deletes the data item with key deleteKey
@@ -203,68 +268,48 @@ bool BSTree<DataType,KeyType>::remove(const KeyType& deleteKey)
     return removeHelper(deleteKey, root);
 }
 
-/** Recursive helper function.
+/** Helper function for remove().
+* Follows the links down from p to the data item with key deleteKey, keeping
+* the link to it so that the node can be unlinked.
 * @param deleteKey is the key to compare all the nodes within BSTree to.
-* @param p is the current node to check against.
+* @param p is the root of the subtree to remove from.
 * @see BSTree<DataType,KeyType>::remove(const KeyType&)
 */
 template<typename DataType, class KeyType>
 bool BSTree<DataType,KeyType>::removeHelper(const KeyType& deleteKey, 
     BSTreeNode*& p)
 {
-    if(p != NULL)
+    BSTreeNode** link = &p;     //Link to the subtree being searched
+    while(*link != NULL && !(deleteKey == ((*link)->dataItem).getKey()))
     {
-        //Delete key found
-        if(deleteKey == (p->dataItem).getKey())
-        {
-            //Node has no children, simply delete
-            if(p->left == NULL && p->right == NULL)
-            {
-                delete p;
-                p = NULL;
-            }
-            //Node only has right child, swap child with parent
-            else if(p->left == NULL)
-            {
-                BSTreeNode* temp = p;
-                p = p->right;
-                delete temp;
-            }
-            //Node only has left child, swap child with parent
-            else if(p->right == NULL)
-            {
-                BSTreeNode* temp = p;
-                p = p->left;
-                delete temp;
-            }
-            //Node has both children, find the node that is directly before the
-            //node in sorted order, delete that one from the tree, and place
-            //its data into the original node
-            else
-            {
-                //Go left one node
-                BSTreeNode* temp = p->left;
-                //Go right as far as you can
-                while(temp->right != NULL)
-                    temp = temp->right;
-                //Temp should now be the node before it in sorted orrder
-                //Swap the data items
-                p->dataItem = temp->dataItem;
-                //Remove the temp node in the tree
-                removeHelper((temp->dataItem).getKey(), p->left);
-            }
-            return true;
-        }
         //Delete key is less than the current node, go left
-        else if(deleteKey < (p->dataItem).getKey())
-            return removeHelper(deleteKey, p->left);
+        if(deleteKey < ((*link)->dataItem).getKey())
+            link = &(*link)->left;
         //Delete key is greater than the current node, go right
         else
-            return removeHelper(deleteKey, p->right);
+            link = &(*link)->right;
     }
     //Node is null
-    else
+    if(*link == NULL)
         return false;
+
+    BSTreeNode* node = *link;
+    //Node has both children, find the node that is directly before the node
+    //in sorted order, place its data into the original node, and delete that
+    //one from the tree instead
+    if(node->left != NULL && node->right != NULL)
+    {
+        //Go left one node, then right as far as you can
+        link = &node->left;
+        while((*link)->right != NULL)
+            link = &(*link)->right;
+        node->dataItem = (*link)->dataItem;
+        node = *link;
+    }
+    //Node has at most one child, swap the child with the node
+    *link = (node->left != NULL) ? node->left : node->right;
+    delete node;
+    return true;
 }
 
 /** Outputs the keys of the data items
@@ -280,19 +325,31 @@ void BSTree<DataType,KeyType>::writeKeys() const
     cout << endl;
 }
 
-/** Recursive helper function.
-* @param p is the current node to check against.
+/** Helper function for writeKeys().
+* To write in ascending order, go left, print, then go right. The nodes whose
+* left subtree is being written wait on a stack.
+* @param p is the root of the subtree to write.
 * @see BSTree<DataType,KeyType>::writeKeys()
 */
 template<typename DataType, class KeyType>
 void BSTree<DataType,KeyType>::writeKeysHelper(BSTreeNode* p) const
 {
-    if(p != NULL)
+    vector<BSTreeNode*> pending;    //Nodes still to be printed
+    for(;;)
     {
-        //To write in ascending order, go left, print, then go right
-        writeKeysHelper(p->left);
+        //Go left as far as you can
+        while(p != NULL)
+        {
+            pending.push_back(p);
+            p = p->left;
+        }
+        if(pending.empty())
+            return;
+        //Print, then go right
+        p = pending.back();
+        pending.pop_back();
         cout << (p->dataItem).getKey() << " ";
-        writeKeysHelper(p->right);
+        p = p->right;
     }
 }
 
@@ -307,28 +364,29 @@ void BSTree<DataType,KeyType>::clear()
     clearHelper(root);
 }
 
-/** Recursive helper function.
-* @param p is the current node to check against.
+/** Helper function for clear().
+* Each node is deleted once its children are on the stack of the nodes still to
+* be deleted.
+* @param p is the root of the subtree to delete. It is set to NULL.
 * @see BSTree<DataType,KeyType>::clear()
 */
 template<typename DataType, class KeyType>
 void BSTree<DataType,KeyType>::clearHelper(BSTreeNode*& p)
 {
+    vector<BSTreeNode*> pending;    //Nodes still to be deleted
     if(p != NULL)
+        pending.push_back(p);
+    while(!pending.empty())
     {
-        //Clear left branch
-        clearHelper(p->left);
-        //Clear right branch
-        clearHelper(p->right);
-        //Can't go left or right, so delete self
-        delete p;
-        //Set all to NULL
-        if(p->left != NULL)
-            p->left = NULL;
-        if(p->right != NULL)
-            p->right = NULL;
-        p = NULL;
+        BSTreeNode* node = pending.back();
+        pending.pop_back();
+        if(node->left != NULL)
+            pending.push_back(node->left);
+        if(node->right != NULL)
+            pending.push_back(node->right);
+        delete node;
     }
+    p = NULL;
 }
 
 /** Returns true if this BSTree is empty.
@@ -353,27 +411,34 @@ int BSTree<DataType,KeyType>::getHeight() const
     return getHeightHelper(root, 0);
 }
 
-/** Recursive helper function.
-* @param p is the current node to check against.
-* @param currentLevel is the level of the current node.
+/** Helper function for getHeight().
+* The nodes still to be checked wait on a stack with their levels.
+* @param p is the root of the subtree to measure.
+* @param currentLevel is the level above p.
+* @return The deepest level of a node in the subtree, or currentLevel if it is
+* empty.
 * @see BSTree<DataType,KeyType>::getHeight()
 */
 template<typename DataType, class KeyType>
 int BSTree<DataType,KeyType>::getHeightHelper(BSTreeNode* p, 
     int currentLevel) const
 {
-    static int maxLevel = 0;
-    //If the node is null, then check the current level with the max level
-    if(p == NULL)
-    {
-        if(currentLevel > maxLevel)
-            maxLevel = currentLevel;
-    }
-    //Continue left and right
-    else
+    int maxLevel = currentLevel;
+    vector< pair<BSTreeNode*, int> > pending;   //Nodes still to be checked
+    if(p != NULL)
+        pending.push_back(make_pair(p, currentLevel + 1));
+    while(!pending.empty())
     {
-        getHeightHelper(p->left, currentLevel + 1);
-        getHeightHelper(p->right, currentLevel + 1);
+        BSTreeNode* node = pending.back().first;
+        int level = pending.back().second;
+        pending.pop_back();
+        if(level > maxLevel)
+            maxLevel = level;
+        //Continue left and right
+        if(node->left != NULL)
+            pending.push_back(make_pair(node->left, level + 1));
+        if(node->right != NULL)
+            pending.push_back(make_pair(node->right, level + 1));
     }
     return maxLevel;
 }
@@ -389,19 +454,31 @@ int BSTree<DataType,KeyType>::getCount() const
     return getCountHelper(root);
 }
 
-/** Recursive helper function.
-* @param p is the current node to check against.
+/** Helper function for getCount().
+* Each node is counted once its children are on the stack of the nodes still to
+* be counted.
+* @param p is the root of the subtree to count.
 * @see BSTree<DataType,KeyType>::getCount()
 */
 template<typename DataType, class KeyType>
 int BSTree<DataType,KeyType>::getCountHelper(BSTreeNode* p) const
 {
-    //Base case, no node so don't add
-    if(p == NULL)
-        return 0;
-    //Add 1 and go left and go right
-    else
-        return 1 + getCountHelper(p->left) + getCountHelper(p->right);
+    int count = 0;
+    vector<BSTreeNode*> pending;    //Nodes still to be counted
+    if(p != NULL)
+        pending.push_back(p);
+    while(!pending.empty())
+    {
+        BSTreeNode* node = pending.back();
+        pending.pop_back();
+        //Add 1 and go left and go right
+        ++count;
+        if(node->left != NULL)
+            pending.push_back(node->left);
+        if(node->right != NULL)
+            pending.push_back(node->right);
+    }
+    return count;
 }
 
 /** Outputs all keys in this BSTree that are less than searchKey.
@@ -449,9 +526,22 @@ void BSTree<DataType,KeyType>::writeLessThanHelper(const KeyType& searchKey,
 */
 template<typename DataType, class KeyType>
 BSTree<DataType,KeyType>::BSTreeNode::BSTreeNode(const DataType& nodeDataItem,
-    BSTreeNode* leftPtr, BSTreeNode* rightPtr)
+    BSTreeNode* leftPtr, BSTreeNode* rightPtr) : dataItem(nodeDataItem),
+    left(leftPtr), right(rightPtr)
+{
+}
+
+/** The move constructor
+* that moves nodeDataItem into the BSTreeNode's data item and sets the
+* BSTreeNode's left and right pointers.
+* @post This BSTreeNode will be a valid initialized BSTreeNode.
+* @param nodeDataItem is the data to be moved into the node.
+* @param leftPtr is the pointer to the left child of this BSTreeNode.
+* @param rightPtr is the pointer to the right child of this BSTreeNode.
+*/
+template<typename DataType, class KeyType>
+BSTree<DataType,KeyType>::BSTreeNode::BSTreeNode(DataType&& nodeDataItem,
+    BSTreeNode* leftPtr, BSTreeNode* rightPtr) :
+    dataItem(std::move(nodeDataItem)), left(leftPtr), right(rightPtr)
 {
-    dataItem = nodeDataItem;
-    left = leftPtr;
-    right = rightPtr;
 }
\ No newline at end of file
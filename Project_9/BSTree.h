@@ -13,6 +13,8 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 using namespace std;
 
@@ -24,14 +26,18 @@ class BSTree                                     // KeyType : key field
     // Constructor
     BSTree ();                         // Default constructor
     BSTree ( const BSTree<DataType,KeyType>& other );   // Copy constructor
+    BSTree ( BSTree<DataType,KeyType>&& other );        // Move constructor
     BSTree& operator= ( const BSTree<DataType,KeyType>& other );
 						  // Overloaded assignment operator
+    BSTree& operator= ( BSTree<DataType,KeyType>&& other );
+						  // Move assignment operator
 
     // Destructor
     ~BSTree ();
 
     // Binary search tree manipulation operations
     void insert ( const DataType& newDataItem );  // Insert data item
+    void insert ( DataType&& newDataItem );       // Move in data item
     bool retrieve ( const KeyType& searchKey, DataType& searchDataItem ) const;
                                                   // Retrieve data item
     bool remove ( const KeyType& deleteKey );            // Remove data item
@@ -58,6 +64,7 @@ class BSTree                                     // KeyType : key field
     
         // Constructor
         BSTreeNode ( const DataType &nodeDataItem, BSTreeNode *leftPtr, BSTreeNode *rightPtr );
+        BSTreeNode ( DataType &&nodeDataItem, BSTreeNode *leftPtr, BSTreeNode *rightPtr );
 
         // Data members
         DataType dataItem;         // Binary search tree data item
@@ -65,10 +72,11 @@ class BSTree                                     // KeyType : key field
                    *right;   // Pointer to the right child
     };
 
-    // Recursive helpers for the public member functions -- insert
-    // prototypes of these functions here.
+    // Helpers for the public member functions. They loop instead of
+    // recursing.
     void copyHelper(BSTreeNode*& p, BSTreeNode* other);
-    void insertHelper(const DataType& newDataItem, BSTreeNode*& p);
+    template <typename ItemType>
+    void insertHelper(ItemType&& newDataItem, BSTreeNode*& p);
     bool retrieveHelper(const KeyType& searchKey, DataType& searchDataItem, BSTreeNode* p) const;
     bool removeHelper(const KeyType& deleteKey, BSTreeNode*& p);
     void writeKeysHelper(BSTreeNode* p) const;
@@ -0,0 +1,602 @@
+/** @file BSTreeAVL.cpp
+* @author Saharrath Kleips
+* @brief This program will implement a self-balancing Binary Search Tree using a
+* linked tree structure.
+* @details The interface matches that of the BSTree in BSTree.cpp. The BSTree
+* takes the shape of the order its keys are inserted in, so keys inserted in
+* sorted order make it a linked list and retrieve() takes O(n) steps. The
+* BSTreeAVL is an AVL tree: every node holds the height of its subtree, and
+* insert() and remove() rotate the nodes on the way back up until the heights
+* of the two subtrees of every node differ by at most one. The height of the
+* tree is then less than 1.45 log2(n + 2), so retrieve(), insert() and remove()
+* take O(log n) steps whatever the order of the keys.
+* /n Note: Binary Search Tree == BSTree, Binary Search Tree Node == BSTreeNode
+*/
+
+//
+// HEADER FILES ////////////////////////////////////////////////////////////////
+//
+
+#include "BSTreeAVL.h"
+using namespace std;
+
+//
+// Binary Search Tree Function Implementations /////////////////////////////////
+//
+
+/* The default constructor
+* that creates an empty binary search tree.
+* @post This BSTreeAVL will be a valid empty BSTreeAVL.
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>::BSTreeAVL()
+{
+    root = NULL;
+}
+
+/** The copy constructor
+* that initializes this BSTreeAVL to be equivalent to the other BSTreeAVL.
+* @post This BSTreeAVL will be a deep copy of the other BSTreeAVL.
+* @param other is the BSTreeAVL that this BSTreeAVL will be made equivalent to.
+* @see BSTreeAVL<DataType,KeyType>::operator=(const BSTreeAVL<DataType,KeyType>&)
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>::BSTreeAVL(const BSTreeAVL<DataType,KeyType>& other)
+{
+    root = NULL;
+    *this = other;
+}
+
+/** The move constructor
+* that takes over the nodes of the other BSTreeAVL.
+* @post The other BSTreeAVL will be a valid empty BSTreeAVL.
+* @param other is the BSTreeAVL whose nodes are taken over.
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>::BSTreeAVL(BSTreeAVL<DataType,KeyType>&& other)
+{
+    root = other.root;
+    other.root = NULL;
+}
+
+/** The overloaded assignment operator
+* that sets this BSTreeAVL to be equivalent to the other BSTreeAVL and returns
+* a reference to this object. The copy has the same shape as the other tree, so
+* it is balanced too.
+* @post This BSTreeAVL will be a deep copy of the other BSTreeAVL.
+* @param other is the BSTreeAVL that this BSTreeAVL will be made equivalent to.
+* @return The reference to this BSTreeAVL.
+* @see BSTreeAVL<DataType,KeyType>::copyHelper(BSTreeNode*&, BSTreeNode*)
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>& BSTreeAVL<DataType,KeyType>::operator=(
+    const BSTreeAVL<DataType,KeyType>& other)
+{
+    if(this == &other)
+        return *this;
+    clear();
+    copyHelper(root, other.root);
+    return *this;
+}
+
+/** The move assignment operator
+* that releases the nodes of this BSTreeAVL and takes over the nodes of the
+* other BSTreeAVL.
+* @post The other BSTreeAVL will be a valid empty BSTreeAVL.
+* @param other is the BSTreeAVL whose nodes are taken over.
+* @return The reference to this BSTreeAVL.
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>& BSTreeAVL<DataType,KeyType>::operator=(
+    BSTreeAVL<DataType,KeyType>&& other)
+{
+    if(this == &other)
+        return *this;
+    clear();
+    root = other.root;
+    other.root = NULL;
+    return *this;
+}
+
+/** Recursive helper function.
+* @param p is the node to copy into (destination node).
+* @param other is the node to copy from (source node).
+* @see BSTreeAVL<DataType,KeyType>::operator=(const BSTreeAVL<DataType,KeyType>&)
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::copyHelper(BSTreeNode*& p, BSTreeNode* other)
+{
+    if(other != NULL)
+    {
+        BSTreeNode *left = NULL;
+        BSTreeNode *right = NULL;
+        copyHelper(left, other->left);  //Copy left branch
+        copyHelper(right, other->right); //Copy right branch
+        p = new BSTreeNode(other->dataItem, left, right);
+    }
+}
+
+/** The destructor
+* that deallocates the memory used to store this BSTreeAVL.
+* @post This BSTreeAVL will be an empty, deallocated, BSTreeAVL.
+* @see BSTreeAVL<DataType,KeyType>::clear()
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>::~BSTreeAVL()
+{
+    clear();
+}
+
+/** Inserts newDataItem into this BSTreeAVL.
+* If a data item with the same key as newDataItem already exists in this tree,
+* then updates that data item with newDataItem.
+* @post newDataItem will be in the tree, and the tree will be balanced.
+* @param newDataItem is the data item to be inserted into this BSTreeAVL.
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::insert(const DataType& newDataItem)
+{
+    insertHelper(newDataItem, root);
+}
+
+/** Moves newDataItem into this BSTreeAVL.
+* Behaves like insert(const DataType&) but moves the data item into its node
+* (or over the data item with the same key) instead of copying it.
+* @post newDataItem will be in the tree, and the tree will be balanced.
+* @param newDataItem is the data item to be moved into this BSTreeAVL.
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::insert(DataType&& newDataItem)
+{
+    insertHelper(std::move(newDataItem), root);
+}
+
+/** Recursive helper function.
+* Inserts as the BSTree does, then rebalances every node on the path back up to
+* the root.
+* @param newDataItem is the data item to insert into the BSTreeAVL.
+* @param p is the current node to check against.
+* @see BSTreeAVL<DataType,KeyType>::insert(const DataType&)
+*/
+template<typename DataType, class KeyType>
+template<typename ItemType>
+void BSTreeAVL<DataType,KeyType>::insertHelper(ItemType&& newDataItem,
+    BSTreeNode*& p)
+{
+    //Base case, p is NULL so there is room to insert
+    if(p == NULL)
+    {
+        p = new BSTreeNode(std::forward<ItemType>(newDataItem), NULL, NULL);
+        return;
+    }
+    //new data is equal to, so update. The shape does not change.
+    if((p->dataItem).getKey() == newDataItem.getKey())
+    {
+        p->dataItem = std::forward<ItemType>(newDataItem);
+        return;
+    }
+    //new data is greater than, so insert left
+    else if((p->dataItem).getKey() > newDataItem.getKey())
+        insertHelper(std::forward<ItemType>(newDataItem), p->left);
+    //new data is less than, so insert right
+    else
+        insertHelper(std::forward<ItemType>(newDataItem), p->right);
+    rebalance(p);
+}
+
+/** Searches this BSTreeAVL for the data item with key searchKey.
+* If this data item is found, then copies the data item to searchDataItem and
+* returns true. Otherwise, returns false with searchDataItem unchanged.
+* @post searchDataItem will be the copied data item if the data item is found.
+* @param searchKey is the key to search this BSTreeAVL for.
+* @param searchDataItem is the data item that will contain the search key's
+* data item if found.
+* @return True if the data item is found. False if the data item is not found.
+* @see BSTreeAVL<DataType,KeyType>::retrieveHelper(const KeyType&, DataType&,
+* BSTreeNode*)
+*/
+template<typename DataType, class KeyType>
+bool BSTreeAVL<DataType,KeyType>::retrieve(const KeyType& searchKey,
+    DataType& searchDataItem) const
+{
+    return retrieveHelper(searchKey, searchDataItem, root);
+}
+
+/** Helper function for retrieve().
+* The search follows one path down from the root, so it loops instead of
+* recursing.
+* @param searchKey is the key to compare all nodes within the BSTreeAVL to.
+* @param searchDataItem will contain the search key's data item if found.
+* @param p is the root of the subtree to search.
+* @see BSTreeAVL<DataType,KeyType>::retrieve(const KeyType&, DataType&)
+*/
+template<typename DataType, class KeyType>
+bool BSTreeAVL<DataType,KeyType>::retrieveHelper(const KeyType& searchKey,
+    DataType& searchDataItem, BSTreeNode* p) const
+{
+    while(p != NULL)
+    {
+        //Key has been found in tree
+        if(searchKey == (p->dataItem).getKey())
+        {
+            searchDataItem = p->dataItem;
+            return true;
+        }
+        //Key is less than, so check left
+        else if(searchKey < (p->dataItem).getKey())
+            p = p->left;
+        //Key is greater than so check right
+        else
+            p = p->right;
+    }
+    //Key not found
+    return false;
+}
+
+/** Deletes the data item with key deleteKey
+* from this BSTreeAVL. If the data item is found, then deletes it from the tree
+* and returns true. Otherwise, returns false.
+* @post This BSTreeAVL will no longer contain the data item with key deleteKey
+* if found, and the tree will be balanced.
+* @param deleteKey is the key of the data item to delete.
+* @return True if the data item is found. False if the data item is not found.
+* @see BSTreeAVL<DataType,KeyType>::removeHelper(const KeyType&, BSTreeNode*&)
+*/
+template<typename DataType, class KeyType>
+bool BSTreeAVL<DataType,KeyType>::remove(const KeyType& deleteKey)
+{
+    return removeHelper(deleteKey, root);
+}
+
+/** Recursive helper function.
+* Removes as the BSTree does, replacing a node with two children by the node
+* directly before it in sorted order, then rebalances every node on the path
+* back up to the root.
+* @param deleteKey is the key to compare all the nodes within BSTreeAVL to.
+* @param p is the current node to check against.
+* @see BSTreeAVL<DataType,KeyType>::remove(const KeyType&)
+*/
+template<typename DataType, class KeyType>
+bool BSTreeAVL<DataType,KeyType>::removeHelper(const KeyType& deleteKey,
+    BSTreeNode*& p)
+{
+    //Node is null
+    if(p == NULL)
+        return false;
+
+    bool isRemoved = true;
+    //Delete key found
+    if(deleteKey == (p->dataItem).getKey())
+    {
+        //Node has at most one child, replace the node by it
+        if(p->left == NULL || p->right == NULL)
+        {
+            BSTreeNode* temp = p;
+            p = (p->left != NULL) ? p->left : p->right;
+            delete temp;
+            //The child was already balanced
+            return true;
+        }
+        //Node has both children, copy the node directly before it in sorted
+        //order into it, then remove that node from the left subtree
+        BSTreeNode* temp = p->left;
+        while(temp->right != NULL)
+            temp = temp->right;
+        p->dataItem = temp->dataItem;
+        removeHelper((temp->dataItem).getKey(), p->left);
+    }
+    //Delete key is less than the current node, go left
+    else if(deleteKey < (p->dataItem).getKey())
+        isRemoved = removeHelper(deleteKey, p->left);
+    //Delete key is greater than the current node, go right
+    else
+        isRemoved = removeHelper(deleteKey, p->right);
+
+    if(isRemoved)
+        rebalance(p);
+    return isRemoved;
+}
+
+/** Outputs the keys of the data items
+* in this BSTreeAVL. The keys are output in ascending order on one line,
+* separated by spaces.
+* @post The keys of each data item are outputted to the console.
+* @see BSTreeAVL<DataType,KeyType>::writeKeysHelper(BSTreeNode*)
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::writeKeys() const
+{
+    writeKeysHelper(root);
+    cout << endl;
+}
+
+/** Recursive helper function.
+* @param p is the current node to check against.
+* @see BSTreeAVL<DataType,KeyType>::writeKeys()
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::writeKeysHelper(BSTreeNode* p) const
+{
+    if(p != NULL)
+    {
+        //To write in ascending order, go left, print, then go right
+        writeKeysHelper(p->left);
+        cout << (p->dataItem).getKey() << " ";
+        writeKeysHelper(p->right);
+    }
+}
+
+/** Removes all data items
+* in this BSTreeAVL.
+* @post This BSTreeAVL will be an empty, deallocated, BSTreeAVL.
+* @see BSTreeAVL<DataType,KeyType>::clearHelper(BSTreeNode*& p)
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::clear()
+{
+    clearHelper(root);
+}
+
+/** Recursive helper function.
+* @param p is the current node to check against.
+* @see BSTreeAVL<DataType,KeyType>::clear()
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::clearHelper(BSTreeNode*& p)
+{
+    if(p != NULL)
+    {
+        clearHelper(p->left);
+        clearHelper(p->right);
+        delete p;
+        p = NULL;
+    }
+}
+
+/** Returns true if this BSTreeAVL is empty.
+* Otherwise, returns false.
+* @return True if this BSTreeAVL is empty. False if this BSTreeAVL is not empty.
+*/
+template<typename DataType, class KeyType>
+bool BSTreeAVL<DataType,KeyType>::isEmpty() const
+{
+    return (root == NULL);
+}
+
+/** Outputs the keys in this BSTreeAVL
+* rotated counterclockwise 90 degrees from its conventional orientation, as
+* BSTree::showStructure() does. Used for testing and debugging.
+* @see BSTreeAVL<DataType,KeyType>::showHelper(BSTreeNode*, int)
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::showStructure() const
+{
+    if(root == NULL)
+        cout << "Empty tree" << endl;
+    else
+    {
+        cout << endl;
+        showHelper(root, 1);
+        cout << endl;
+    }
+}
+
+/** Recursive helper function.
+* Outputs the right subtree, the key of p with a connector showing which
+* children it has, then the left subtree.
+* @param p is the root of the subtree to output.
+* @param level is the level of p within the tree.
+* @see BSTreeAVL<DataType,KeyType>::showStructure()
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::showHelper(BSTreeNode* p, int level) const
+{
+    if(p != NULL)
+    {
+        showHelper(p->right, level + 1);
+        for(int j = 0; j < level; j++)
+            cout << "\t";
+        cout << " " << (p->dataItem).getKey();
+        if(p->left != NULL && p->right != NULL)
+            cout << "<";
+        else if(p->right != NULL)
+            cout << "/";
+        else if(p->left != NULL)
+            cout << "\\";
+        cout << endl;
+        showHelper(p->left, level + 1);
+    }
+}
+
+/** Returns the height
+* of this BSTreeAVL. The root holds it, so no nodes are visited.
+* @return An integer representation of the height of this BSTreeAVL.
+*/
+template<typename DataType, class KeyType>
+int BSTreeAVL<DataType,KeyType>::getHeight() const
+{
+    return heightOf(root);
+}
+
+/** Returns the count
+* of the number of data items in this BSTreeAVL.
+* @return An integer representation of how many data items are in this
+* BSTreeAVL.
+* @see BSTreeAVL<DataType,KeyType>::getCountHelper(BSTreeNode*)
+*/
+template<typename DataType, class KeyType>
+int BSTreeAVL<DataType,KeyType>::getCount() const
+{
+    return getCountHelper(root);
+}
+
+/** Recursive helper function.
+* @param p is the current node to check against.
+* @see BSTreeAVL<DataType,KeyType>::getCount()
+*/
+template<typename DataType, class KeyType>
+int BSTreeAVL<DataType,KeyType>::getCountHelper(BSTreeNode* p) const
+{
+    if(p == NULL)
+        return 0;
+    else
+        return 1 + getCountHelper(p->left) + getCountHelper(p->right);
+}
+
+/** Outputs all keys in this BSTreeAVL that are less than searchKey.
+* The keys are output in ascending order on one line, separated by spaces.
+* searchKey does not need to be a key in this BSTreeAVL.
+* @post The keys less than searchKey are outputted to the console.
+* @param searchKey is the key to compare this BSTreeAVL's keys to.
+* @see BSTreeAVL<DataType,KeyType>::writeLessThanHelper(const KeyType&,
+* BSTreeNode*)
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::writeLessThan(const KeyType& searchKey) const
+{
+    writeLessThanHelper(searchKey, root);
+}
+
+/** Recursive helper function.
+* Only the subtrees that can hold keys less than searchKey are visited.
+* @param searchKey is the key to compare this BSTreeAVL's keys to.
+* @param p is the current node to check against.
+* @see BSTreeAVL<DataType,KeyType>::writeLessThan(const KeyType&)
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::writeLessThanHelper(const KeyType& searchKey,
+    BSTreeNode* p) const
+{
+    if(p != NULL)
+    {
+        writeLessThanHelper(searchKey, p->left);
+        //The right subtree only has keys less than searchKey if p does
+        if((p->dataItem).getKey() < searchKey)
+        {
+            cout << (p->dataItem).getKey() << " ";
+            writeLessThanHelper(searchKey, p->right);
+        }
+    }
+}
+
+/** Returns the height
+* of the subtree rooted at p.
+* @param p is the root of the subtree, or NULL.
+* @return The height, which is 0 for an empty subtree.
+*/
+template<typename DataType, class KeyType>
+int BSTreeAVL<DataType,KeyType>::heightOf(BSTreeNode* p)
+{
+    return (p == NULL) ? 0 : p->height;
+}
+
+/** Sets the height
+* of p from the heights of its children.
+* @param p is the node to update.
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::updateHeight(BSTreeNode* p)
+{
+    int leftHeight = heightOf(p->left);
+    int rightHeight = heightOf(p->right);
+    p->height = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+}
+
+/** Rotates the subtree rooted at p to the left:
+* the right child of p takes its place, and p becomes its left child.
+* @pre p has a right child.
+* @param p is the root of the subtree. It is set to the new root.
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::rotateLeft(BSTreeNode*& p)
+{
+    BSTreeNode* child = p->right;
+    p->right = child->left;
+    child->left = p;
+    updateHeight(p);
+    updateHeight(child);
+    p = child;
+}
+
+/** Rotates the subtree rooted at p to the right:
+* the left child of p takes its place, and p becomes its right child.
+* @pre p has a left child.
+* @param p is the root of the subtree. It is set to the new root.
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::rotateRight(BSTreeNode*& p)
+{
+    BSTreeNode* child = p->left;
+    p->left = child->right;
+    child->right = p;
+    updateHeight(p);
+    updateHeight(child);
+    p = child;
+}
+
+/** Restores the balance
+* of the subtree rooted at p after one of its subtrees grew or shrank by one
+* level. If one subtree is two levels higher than the other, one rotation (or
+* two, if the higher subtree leans the other way) makes them differ by at most
+* one.
+* @pre The subtrees of p are balanced.
+* @param p is the root of the subtree. It is set to the new root.
+*/
+template<typename DataType, class KeyType>
+void BSTreeAVL<DataType,KeyType>::rebalance(BSTreeNode*& p)
+{
+    int balance = heightOf(p->left) - heightOf(p->right);
+    //Left subtree is too high
+    if(balance > 1)
+    {
+        if(heightOf(p->left->left) < heightOf(p->left->right))
+            rotateLeft(p->left);
+        rotateRight(p);
+    }
+    //Right subtree is too high
+    else if(balance < -1)
+    {
+        if(heightOf(p->right->right) < heightOf(p->right->left))
+            rotateRight(p->right);
+        rotateLeft(p);
+    }
+    else
+        updateHeight(p);
+}
+
+//
+// Binary Search Tree Node Function Implmentations /////////////////////////////
+//
+
+/** The parameterized constructor
+* that sets the BSTreeNode's data item to the value nodeDataItem and its left
+* and right pointers to leftPtr and rightPtr. The height is computed from the
+* heights of the children.
+* @post This BSTreeNode will be a valid initialized BSTreeNode.
+* @param nodeDataItem is the data to be stored within the node.
+* @param leftPtr is the pointer to the left child of this BSTreeNode.
+* @param rightPtr is the pointer to the right child of this BSTreeNode.
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>::BSTreeNode::BSTreeNode(const DataType& nodeDataItem,
+    BSTreeNode* leftPtr, BSTreeNode* rightPtr) : dataItem(nodeDataItem),
+    left(leftPtr), right(rightPtr)
+{
+    updateHeight(this);
+}
+
+/** The move constructor
+* that moves nodeDataItem into the BSTreeNode's data item and sets the
+* BSTreeNode's left and right pointers and height.
+* @post This BSTreeNode will be a valid initialized BSTreeNode.
+* @param nodeDataItem is the data to be moved into the node.
+* @param leftPtr is the pointer to the left child of this BSTreeNode.
+* @param rightPtr is the pointer to the right child of this BSTreeNode.
+*/
+template<typename DataType, class KeyType>
+BSTreeAVL<DataType,KeyType>::BSTreeNode::BSTreeNode(DataType&& nodeDataItem,
+    BSTreeNode* leftPtr, BSTreeNode* rightPtr) :
+    dataItem(std::move(nodeDataItem)), left(leftPtr), right(rightPtr)
+{
+    updateHeight(this);
+}
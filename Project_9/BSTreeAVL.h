@@ -0,0 +1,99 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 9                                    BSTreeAVL.h
+//
+//  Class declarations for the self-balancing (AVL) linked
+//  implementation of the Binary Search Tree ADT -- including the
+//  recursive helpers of the public member functions
+//
+//--------------------------------------------------------------------
+
+#ifndef BSTREEAVL_H
+#define BSTREEAVL_H
+
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+
+using namespace std;
+
+template < typename DataType, class KeyType >    // DataType : tree data item
+class BSTreeAVL                                  // KeyType : key field
+{
+  public:
+
+    // Constructor
+    BSTreeAVL ();                      // Default constructor
+    BSTreeAVL ( const BSTreeAVL<DataType,KeyType>& other ); // Copy constructor
+    BSTreeAVL ( BSTreeAVL<DataType,KeyType>&& other );      // Move constructor
+    BSTreeAVL& operator= ( const BSTreeAVL<DataType,KeyType>& other );
+						  // Overloaded assignment operator
+    BSTreeAVL& operator= ( BSTreeAVL<DataType,KeyType>&& other );
+						  // Move assignment operator
+
+    // Destructor
+    ~BSTreeAVL ();
+
+    // Binary search tree manipulation operations
+    void insert ( const DataType& newDataItem );  // Insert data item
+    void insert ( DataType&& newDataItem );       // Move in data item
+    bool retrieve ( const KeyType& searchKey, DataType& searchDataItem ) const;
+                                                  // Retrieve data item
+    bool remove ( const KeyType& deleteKey );            // Remove data item
+    void writeKeys () const;                      // Output keys
+    void clear ();                                // Clear tree
+
+    // Binary search tree status operations
+    bool isEmpty () const;                        // Tree is empty
+
+    // Output the tree structure -- used in testing/debugging
+    void showStructure () const;
+
+    // In-lab operations
+    int getHeight () const;                       // Height of tree
+    int getCount () const;			  // Number of nodes in tree
+    void writeLessThan ( const KeyType& searchKey ) const; // Output keys < searchKey
+
+  protected:
+
+    class BSTreeNode                  // Inner class: facilitator for the BSTreeAVL class
+    {
+      public:
+
+        // Constructor
+        BSTreeNode ( const DataType &nodeDataItem, BSTreeNode *leftPtr, BSTreeNode *rightPtr );
+        BSTreeNode ( DataType &&nodeDataItem, BSTreeNode *leftPtr, BSTreeNode *rightPtr );
+
+        // Data members
+        DataType dataItem;         // Binary search tree data item
+        BSTreeNode *left,    // Pointer to the left child
+                   *right;   // Pointer to the right child
+        int height;          // Height of the subtree rooted here
+    };
+
+    // Recursive helpers for the public member functions. The helpers
+    // that change the tree rebalance every node on the way back up, so
+    // they recurse at most getHeight() levels.
+    void copyHelper(BSTreeNode*& p, BSTreeNode* other);
+    template <typename ItemType>
+    void insertHelper(ItemType&& newDataItem, BSTreeNode*& p);
+    bool retrieveHelper(const KeyType& searchKey, DataType& searchDataItem, BSTreeNode* p) const;
+    bool removeHelper(const KeyType& deleteKey, BSTreeNode*& p);
+    void writeKeysHelper(BSTreeNode* p) const;
+    void clearHelper(BSTreeNode*& p);
+    int getCountHelper(BSTreeNode* p) const;
+    void writeLessThanHelper(const KeyType& searchKey, BSTreeNode* p) const;
+    void showHelper(BSTreeNode *p, int level) const;
+
+    // Balancing helpers
+    static int heightOf(BSTreeNode* p);
+    static void updateHeight(BSTreeNode* p);
+    static void rotateLeft(BSTreeNode*& p);
+    static void rotateRight(BSTreeNode*& p);
+    static void rebalance(BSTreeNode*& p);
+
+    // Data member
+    BSTreeNode *root;   // Pointer to the root node
+};
+
+#endif	// define BSTREEAVL_H
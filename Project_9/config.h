@@ -7,4 +7,5 @@
 #define LAB9_TEST1	1		// Programming Exercise 2: getCount
 #define LAB9_TEST2	1		// Programming Exercise 2: getHeight
 #define LAB9_TEST3	0		// Programming Exercise 3: writeLessThan
+#define LAB9_TEST4	0		// 1 means test the self-balancing (AVL) tree
 
@@ -11,7 +11,7 @@
 
 #include <iostream>
 #include <fstream>
-#include "BSTree.cpp"
+#include "BSTreeAVL.cpp"
 
 using namespace std;
 
@@ -54,7 +54,8 @@ int main ()
 {
     ifstream acctFile ("accounts.dat");   // Accounts database file
     AccountRecord acctRec;                // Account record
-    BSTree<IndexEntry,int> index;         // Database index
+    BSTreeAVL<IndexEntry,int> index;      // Database index, balanced
+                                          //   since IDs may be sorted
     IndexEntry entry;                     // Index entry
     int searchID;                         // User input account ID
     long recNum;                          // Record number
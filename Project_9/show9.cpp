@@ -34,16 +34,29 @@ template < typename DataType, typename KeyType >
 void BSTree<DataType,KeyType>:: showHelper ( BSTreeNode *p,
                                int level             ) const
 
-// Recursive helper for showStructure. 
+// Helper for showStructure. 
 // Outputs the subtree whose root node is pointed to by p. 
 // Parameter level is the level of this node within the tree.
+// The nodes whose right subtree is being output wait on a stack with
+// their levels, so a deep tree cannot overflow the call stack.
 
 {
      int j;   // Loop counter
+     vector< pair<BSTreeNode*,int> > pending;   // Nodes still to output
 
-     if ( p != 0 )
+     for ( ;; )
      {
-        showHelper(p->right,level+1);         // Output right subtree
+        while ( p != 0 )                   // Go right as far as you can
+        {
+            pending.push_back(make_pair(p,level));
+            p = p->right;
+            level++;
+        }
+        if ( pending.empty() )
+           return;
+        p = pending.back().first;
+        level = pending.back().second;
+        pending.pop_back();
         for ( j = 0 ; j < level ; j++ )    // Tab over to level
             cout << "\t";
         cout << " " << p->dataItem.getKey();   // Output key
@@ -55,7 +68,8 @@ void BSTree<DataType,KeyType>:: showHelper ( BSTreeNode *p,
         else if ( p->left != 0 )
            cout << "\\";
         cout << endl;
-        showHelper(p->left,level+1);          // Output left subtree
+        p = p->left;                       // Output left subtree
+        level++;
     }
 }
 
@@ -9,8 +9,12 @@
 using namespace std;
 
 #include <iostream>
-#include "BSTree.cpp"
 #include "config.h"
+#if LAB9_TEST4
+#   include "BSTreeAVL.cpp"
+#else
+#   include "BSTree.cpp"
+#endif
 
 void print_help();
 
@@ -35,7 +39,11 @@ class TestData
 
 int main()
 {
+#if LAB9_TEST4
+    BSTreeAVL<TestData,int> testTree;   // Test binary search tree
+#else
     BSTree<TestData,int> testTree;   // Test binary search tree
+#endif
     TestData testData;               // Binary search tree data item
     int inputKey;                    // User input key
     char cmd;                        // Input command
@@ -0,0 +1,137 @@
+//--------------------------------------------------------------------
+//
+//  Laboratory 9                                        timebstree.cpp
+//
+//  Compares the unbalanced and self-balancing (AVL) implementations
+//  of the Binary Search Tree ADT on sorted, reverse-sorted and random
+//  streams of keys
+//
+//--------------------------------------------------------------------
+
+#include <iostream>
+#include <streambuf>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include "BSTree.cpp"
+#include "BSTreeAVL.cpp"
+#include "../Project_13/Timer.cpp"
+
+// Data item with an integer key, as in test9.cpp
+class TestData
+{
+  public:
+
+    TestData ( int newKey = 0 )
+        { keyField = newKey; }
+
+    int getKey () const
+        { return keyField; }     // Returns the key
+
+  private:
+
+    int keyField;                // Key for the data item
+};
+
+// A sorted stream of keys makes the BSTree a list, and inserting n
+// keys takes O(n^2) steps, so longer sorted streams only time the AVL
+// tree.
+const int maxUnbalancedKeys = 100000;
+
+// Discards whatever is written to it, so that writeKeys() can be timed
+// without the cost of output
+class NullBuffer : public streambuf
+{
+  protected:
+    int overflow ( int c )
+        { return c; }
+};
+
+// Inserts every key, retrieves every key, writes the keys in order,
+// then removes every key, in the order of keys.
+template <typename TreeType>
+void timeTree(const vector<int>& keys, const string& name)
+{
+    TreeType testTree;
+    TestData testData;
+    Timer t;
+
+    t.start();
+    for (size_t i = 0; i < keys.size(); ++i)
+	testTree.insert(TestData(keys[i]));
+    t.stop();
+    double insertTime = t.getElapsedTime();
+
+    int numFound = 0;
+    t.start();
+    for (size_t i = 0; i < keys.size(); ++i)
+	numFound += testTree.retrieve(keys[i], testData);
+    t.stop();
+    double retrieveTime = t.getElapsedTime();
+
+    NullBuffer nullBuffer;
+    streambuf* coutBuffer = cout.rdbuf(&nullBuffer);
+    t.start();
+    testTree.writeKeys();
+    t.stop();
+    cout.rdbuf(coutBuffer);
+    double writeTime = t.getElapsedTime();
+
+    int numRemoved = 0;
+    t.start();
+    for (size_t i = 0; i < keys.size(); ++i)
+	numRemoved += testTree.remove(keys[i]);
+    t.stop();
+    double removeTime = t.getElapsedTime();
+
+    cout << "  " << name << " insert " << insertTime << ", retrieve "
+	 << retrieveTime << ", writeKeys " << writeTime << ", remove "
+	 << removeTime << " sec";
+    if (numFound != int(keys.size()) || numRemoved != int(keys.size())
+	|| !testTree.isEmpty())
+	cout << " (KEYS LOST)";
+    cout << endl;
+}
+
+// Times both trees on one stream of keys. The height of the AVL tree
+// shows the bound on the length of every search.
+void timeStream(const vector<int>& keys, const string& name, bool isSorted)
+{
+    BSTreeAVL<TestData,int> balanced;
+    for (size_t i = 0; i < keys.size(); ++i)
+	balanced.insert(TestData(keys[i]));
+
+    cout << name << " keys (AVL height " << balanced.getHeight()
+	 << ")" << endl;
+    if (!isSorted || int(keys.size()) <= maxUnbalancedKeys)
+	timeTree< BSTree<TestData,int> >(keys, "BSTree   ");
+    timeTree< BSTreeAVL<TestData,int> >(keys, "BSTreeAVL");
+}
+
+int main() {
+    cout << endl << "Enter the number of keys: ";
+    int numKeys;
+    cin >> numKeys;
+    if (!cin || numKeys < 1) {
+	cout << "input error" << endl;
+	return 1;
+    }
+
+    vector<int> keys(numKeys);
+    for (int i = 0; i < numKeys; ++i)
+	keys[i] = i;
+    timeStream(keys, "Sorted", true);
+
+    for (int i = 0; i < numKeys; ++i)
+	keys[i] = numKeys - 1 - i;
+    timeStream(keys, "Reverse-sorted", true);
+
+    for (int i = numKeys - 1; i > 0; --i)
+	swap(keys[i], keys[rand() % (i + 1)]);
+    timeStream(keys, "Random", false);
+
+    return 0;
+}